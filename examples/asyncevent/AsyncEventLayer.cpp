@@ -16,32 +16,65 @@ void AsyncEventLayer::OnAttach()
     Nodens::AsyncEventBus::Get().Subscribe<PlanetaryScanEvent>(
         [this](PlanetaryScanEvent& e)
         {
-            // 1. Start Timer
-            auto start = std::chrono::high_resolution_clock::now();
+            // Simulate the work and generate the data
+            SimulateScan(e);
 
-            // 2. SIMULATE WORK & GENERATE DATA
-            // We use thread-local random engines for safety and speed
-            static thread_local std::mt19937 generator(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            // Report back on the main thread: no lock shared with rendering, and a burst of results is spread
+            // over frames by the executor's budget
+            Nodens::Application::Get().GetMainThreadExecutor().Post([this, e]() { AddResult(e); });
+        });
+}
+
+void AsyncEventLayer::SimulateScan(PlanetaryScanEvent& e)
+{
+    // 1. Start Timer
+    auto start = std::chrono::high_resolution_clock::now();
 
-            // Randomize sleep (0.5s to 2.5s) to simulate variable workloads
-            std::uniform_int_distribution<int> sleepDist(500, 2500);
-            std::this_thread::sleep_for(std::chrono::milliseconds(sleepDist(generator)));
+    // 2. SIMULATE WORK & GENERATE DATA
+    // We use thread-local random engines for safety and speed
+    static thread_local std::mt19937 generator(std::hash<std::thread::id>{}(std::this_thread::get_id()));
 
-            // Generate "Scientific Data"
-            std::uniform_real_distribution<float> distDist(0.1f, 100.0f);   // 0 to 100 Light Years
-            std::normal_distribution<float>       densityDist(0.5f, 0.15f); // Atmosphere density
+    // Randomize sleep (0.5s to 2.5s) to simulate variable workloads
+    std::uniform_int_distribution<int> sleepDist(500, 2500);
+    std::this_thread::sleep_for(std::chrono::milliseconds(sleepDist(generator)));
 
-            e.m_Distance          = distDist(generator);
-            e.m_AtmosphereDensity = densityDist(generator);
+    // Generate "Scientific Data"
+    std::uniform_real_distribution<float> distDist(0.1f, 100.0f);   // 0 to 100 Light Years
+    std::normal_distribution<float>       densityDist(0.5f, 0.15f); // Atmosphere density
 
-            // 3. Calculate Duration
-            auto                         end      = std::chrono::high_resolution_clock::now();
-            std::chrono::duration<float> duration = end - start;
-            e.m_CalculationTime                   = duration.count();
+    e.m_Distance          = distDist(generator);
+    e.m_AtmosphereDensity = densityDist(generator);
 
-            // 4. Report Back (Thread-Safe)
-            AddResult(e);
-        });
+    // 3. Calculate Duration
+    auto                         end      = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<float> duration = end - start;
+    e.m_CalculationTime                   = duration.count();
+}
+
+Nodens::Task<PlanetaryScanEvent> AsyncEventLayer::ScanPlanet(int id)
+{
+    // Hop onto a blocking-pool thread (the scan sleeps); the main thread continues rendering meanwhile
+    co_await Nodens::Application::Get().GetJobSystem().Schedule({.Pool = Nodens::WorkerPool::Blocking});
+
+    PlanetaryScanEvent e(id);
+    SimulateScan(e);
+    co_return e;
+}
+
+Nodens::Task<void> AsyncEventLayer::RunScanMission(int id)
+{
+    // No ZoneScoped here: a Tracy zone cannot span a suspension, which may resume on another thread.
+    // Each step suspends the mission instead of blocking a thread while it waits
+    PlanetaryScanEvent first  = co_await ScanPlanet(id);
+    PlanetaryScanEvent second = co_await ScanPlanet(id);
+
+    // Back on the main thread for the report
+    co_await Nodens::NextFrame();
+
+    m_MissionsCompleted++;
+    ND_INFO("Scan mission {0} finished: {1:.1f} and {2:.1f} light years", id, first.m_Distance, second.m_Distance);
+    AddResult(first);
+    AddResult(second);
 }
 
 void AsyncEventLayer::OnUpdate(Nodens::TimeStep ts)
@@ -51,8 +84,6 @@ void AsyncEventLayer::OnUpdate(Nodens::TimeStep ts)
 
 void AsyncEventLayer::AddResult(const PlanetaryScanEvent& e)
 {
-    std::lock_guard<std::mutex> lock(m_DataMutex);
-
     m_GalaxyDistances.push_back(e.m_Distance);
     m_GalaxyDensities.push_back(e.m_AtmosphereDensity);
 
@@ -77,22 +108,43 @@ void AsyncEventLayer::OnImGuiRender(Nodens::TimeStep ts)
     ImGui::Begin("Deep Space Analytics");
     ImGui::Text("Engine Time: %.2f s | FPS: %.1f", m_TimePassed, ImGui::GetIO().Framerate);
 
+    // The scan handler sleeps, so its events go to the blocking pool and never occupy a compute worker
     if (ImGui::Button("Launch Single Probe"))
     {
-        PlanetaryScanEvent e(++m_ScanCounter);
-        Nodens::AsyncEventBus::Get().Publish(e);
+        // Constructed in place in pooled storage, no temporary event to copy
+        Nodens::AsyncEventBus::Get().Emplace<PlanetaryScanEvent>({.Pool = Nodens::WorkerPool::Blocking},
+                                                                 ++m_ScanCounter);
     }
     ImGui::SameLine();
     if (ImGui::Button("Launch Swarm (20 Probes)"))
     {
+        // A swarm is bulk work: background priority, so it yields to anything else waiting for a thread.
+        // Published as one batch, so the job queue is locked once rather than once per probe.
+        // A new swarm supersedes the previous one: its probes that have not launched yet are dropped.
+        m_SwarmCancellation.Reset();
+        std::vector<PlanetaryScanEvent> probes;
         for (int i = 0; i < 20; i++)
         {
-            PlanetaryScanEvent e(++m_ScanCounter);
-            Nodens::AsyncEventBus::Get().Publish(e);
+            probes.emplace_back(++m_ScanCounter);
         }
+        Nodens::AsyncEventBus::Get().PublishBatch<PlanetaryScanEvent>(
+            probes,
+            {.Priority     = Nodens::JobPriority::Background,
+             .Pool         = Nodens::WorkerPool::Blocking,
+             .Cancellation = m_SwarmCancellation.GetToken()});
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Recall Swarm"))
+    {
+        m_SwarmCancellation.Cancel();
     }
+    ImGui::SameLine();
+    if (ImGui::Button("Launch Scan Mission (Coroutine)"))
+    {
+        RunScanMission(++m_ScanCounter).Detach();
+    }
+    ImGui::Text("Coroutine missions completed: %d", m_MissionsCompleted);
     ImGui::Separator();
-    std::lock_guard<std::mutex> lock(m_DataMutex);
     if (ImPlot::BeginPlot("Galaxy Composition Analysis", ImVec2(-1, 0)))
     { // -1,0 fills available space
         ImPlot::SetupAxes(
@@ -120,4 +172,8 @@ void AsyncEventLayer::OnImGuiRender(Nodens::TimeStep ts)
         ImPlot::EndPlot();
     }
     ImGui::End();
+
+    ImGui::Begin("Event Bus Benchmark");
+    m_BusBenchmark.OnImGuiRender();
+    ImGui::End();
 }
\ No newline at end of file
@@ -1,11 +1,11 @@
 #pragma once
 
 #include "AsyncEvent.h"
+#include "EventBusBenchmark.h"
 #include "nodens.h"
 #include <Nodens/Events/AsyncEventBus.h>
 #include <implot.h>
 
-#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -34,20 +34,37 @@ public:
 
 private:
     /// @brief Adds a scan result to the data vectors.
-    /// This function is thread-safe.
+    /// Main thread only; workers post their results there (see OnAttach()).
     /// @param e The event containing the scan results.
     void AddResult(const PlanetaryScanEvent& e);
 
+    /// @brief Fills in the scan results, sleeping to simulate a variable workload.
+    /// @param e The event to fill.
+    static void SimulateScan(PlanetaryScanEvent& e);
+
+    /// @brief Scans a planet on a blocking-pool thread.
+    /// @param id The ID of the planet to scan.
+    static Nodens::Task<PlanetaryScanEvent> ScanPlanet(int id);
+
+    /// @brief Runs two scans one after the other and reports them on the main thread, written as a coroutine.
+    /// @param id The ID of the planet to scan.
+    Nodens::Task<void> RunScanMission(int id);
+
 private:
     // Simulation State
     float m_TimePassed  = 0.0f;
     int   m_ScanCounter = 0;
 
+    // Only touched on the main thread (coroutines return there with NextFrame())
+    int m_MissionsCompleted = 0;
+
+    // Probes of the latest swarm; cancelling drops those still waiting for a thread
+    Nodens::CancellationGroup m_SwarmCancellation;
+
     // ==============================================================
     // VISUALIZATION DATA
+    // Only touched on the main thread
     // ==============================================================
-    std::mutex m_DataMutex;
-
     // Plot 1: Galaxy Composition (Scatter Plot)
     std::vector<float> m_GalaxyDistances; // X-Axis
     std::vector<float> m_GalaxyDensities; // Y-Axis
@@ -55,4 +72,7 @@ private:
     // Plot 2: Performance Stats (Line/Histogram)
     std::vector<float> m_LatencyHistory;
     float              m_MaxLatency = 0.0f;
+
+    // Dispatch throughput benchmark shown in its own window
+    EventBusBenchmark m_BusBenchmark;
 };
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "EventBusBenchmark.h"
+
+#include <imgui.h>
+#include <implot.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+
+/// @brief Event type of one benchmark scenario; each scenario gets its own type.
+template <std::size_t Scenario> struct BusBenchmarkEvent : public Nodens::EventImpl<BusBenchmarkEvent<Scenario>>
+{
+    static constexpr char Name[]   = "BusBenchmarkEvent";
+    static constexpr int  Category = 0;
+
+    BusBenchmarkEvent(int value) : m_Value(value) {}
+
+    int m_Value;
+};
+
+// Where the handlers put their (meaningless) work, so it cannot be optimized away. Per thread, so the handlers do
+// not contend on it.
+static thread_local int t_Sink = 0;
+
+template <std::size_t Index> void EventBusBenchmark::SubscribeScenario()
+{
+    using ScenarioEvent         = BusBenchmarkEvent<Index>;
+    constexpr Scenario scenario = kScenarios[Index];
+
+    auto countDispatched = [this](int count)
+    {
+        if (m_Dispatched.fetch_add(count, std::memory_order_relaxed) + count == GetExpectedCount<Index>())
+            m_Dispatched.notify_all();
+    };
+
+    if constexpr (scenario.Ordered)
+    {
+        // One strand per subscriber: each sees the events in order and one at a time, the strands run in parallel.
+        for (int i = 0; i < scenario.Subscribers; ++i)
+        {
+            Nodens::AsyncEventBus::Get().SubscribeOrdered<ScenarioEvent>(
+                [countDispatched](ScenarioEvent& e)
+                {
+                    t_Sink += e.m_Value;
+                    countDispatched(1);
+                });
+        }
+    }
+    else if constexpr (scenario.Batched)
+    {
+        Nodens::AsyncEventBus::Get().EnableBatching<ScenarioEvent>({.MaxEvents = kBatchSize});
+
+        for (int i = 0; i < scenario.Subscribers - 1; ++i)
+        {
+            Nodens::AsyncEventBus::Get().SubscribeBatch<ScenarioEvent>(
+                [](std::span<ScenarioEvent> events)
+                {
+                    for (ScenarioEvent& e : events)
+                        t_Sink += e.m_Value;
+                });
+        }
+
+        // Handlers run in subscription order, so the last one sees the batch once all the others are done with it.
+        Nodens::AsyncEventBus::Get().SubscribeBatch<ScenarioEvent>(
+            [countDispatched](std::span<ScenarioEvent> events)
+            {
+                for (ScenarioEvent& e : events)
+                    t_Sink += e.m_Value;
+                countDispatched(static_cast<int>(events.size()));
+            });
+    }
+    else
+    {
+        for (int i = 0; i < scenario.Subscribers - 1; ++i)
+        {
+            Nodens::AsyncEventBus::Get().Subscribe<ScenarioEvent>([](ScenarioEvent& e) { t_Sink += e.m_Value; });
+        }
+
+        // Handlers run in subscription order, so the last one sees the event once all the others are done with it.
+        Nodens::AsyncEventBus::Get().Subscribe<ScenarioEvent>(
+            [countDispatched](ScenarioEvent& e)
+            {
+                t_Sink += e.m_Value;
+                countDispatched(1);
+            });
+    }
+}
+
+template <std::size_t Index> float EventBusBenchmark::RunScenario(unsigned int publisherCount)
+{
+    ZoneScopedN("Benchmark Scenario");
+
+    using ScenarioEvent = BusBenchmarkEvent<Index>;
+
+    m_Dispatched = 0;
+    auto start   = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> publishers;
+        for (unsigned int p = 0; p < publisherCount; ++p)
+        {
+            // Spread the events evenly; the first publishers take the remainder.
+            const int count = kEventsPerRun / publisherCount + (p < kEventsPerRun % publisherCount ? 1 : 0);
+            publishers.emplace_back(
+                [count]()
+                {
+                    for (int i = 0; i < count; ++i)
+                    {
+                        Nodens::AsyncEventBus::Get().Emplace<ScenarioEvent>(i);
+                    }
+                });
+        }
+    }
+
+    // The last partial batch would otherwise wait for the end of the frame.
+    if constexpr (kScenarios[Index].Batched)
+        Nodens::AsyncEventBus::Get().Flush();
+
+    // Wait for the last event to reach its last subscriber.
+    for (int value = m_Dispatched.load(); value != GetExpectedCount<Index>(); value = m_Dispatched.load())
+        m_Dispatched.wait(value);
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<float>(kEventsPerRun / elapsed.count());
+}
+
+void EventBusBenchmark::Start()
+{
+    if (m_Running.exchange(true))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_ResultMutex);
+        m_PublisherCounts.clear();
+        for (std::vector<float>& results : m_EventsPerMs)
+            results.clear();
+    }
+
+    // On the main thread, before any benchmark event is in flight.
+    if (!m_Subscribed)
+    {
+        [this]<std::size_t... I>(std::index_sequence<I...>)
+        { (SubscribeScenario<I>(), ...); }(std::make_index_sequence<kScenarios.size()>());
+        m_Subscribed = true;
+    }
+
+    m_Thread = std::jthread(
+        [this](std::stop_token stoken)
+        {
+            tracy::SetThreadName("Benchmark");
+
+            const unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+            for (unsigned int publishers = 1; publishers <= maxThreads && !stoken.stop_requested(); publishers *= 2)
+            {
+                std::array<float, kScenarios.size()> eventsPerMs;
+                [&]<std::size_t... I>(std::index_sequence<I...>)
+                { ((eventsPerMs[I] = RunScenario<I>(publishers)), ...); }(
+                    std::make_index_sequence<kScenarios.size()>());
+
+                std::lock_guard<std::mutex> lock(m_ResultMutex);
+                m_PublisherCounts.push_back(static_cast<float>(publishers));
+                for (std::size_t i = 0; i < eventsPerMs.size(); ++i)
+                    m_EventsPerMs[i].push_back(eventsPerMs[i]);
+            }
+
+            m_Running = false;
+        });
+}
+
+void EventBusBenchmark::OnImGuiRender()
+{
+    if (IsRunning())
+    {
+        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Benchmark running...");
+    }
+    else if (ImGui::Button("Run Dispatch Benchmark"))
+    {
+        Start();
+    }
+    ImGui::Text("%d events per run, published concurrently by 1..N threads.", kEventsPerRun);
+
+    std::lock_guard<std::mutex> lock(m_ResultMutex);
+    if (ImPlot::BeginPlot("Dispatch Throughput", ImVec2(-1, 250)))
+    {
+        ImPlot::SetupAxes("Publisher threads", "Events / ms", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        for (std::size_t i = 0; i < kScenarios.size(); ++i)
+        {
+            if (m_EventsPerMs[i].empty())
+                continue;
+
+            std::string label = std::to_string(kScenarios[i].Subscribers) + " subscribers";
+            if (kScenarios[i].Batched)
+                label += ", batched";
+            if (kScenarios[i].Ordered)
+                label += ", ordered";
+            ImPlot::PlotLine(label.c_str(), m_PublisherCounts.data(), m_EventsPerMs[i].data(),
+                             (int)m_EventsPerMs[i].size());
+        }
+        ImPlot::EndPlot();
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "nodens.h"
+#include <Nodens/Events/AsyncEventBus.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief Dispatch throughput benchmark for the Nodens::AsyncEventBus.
+/// Publishes a burst of events from 1..N threads at once to event types with 1 to 64 subscribers, and plots how many
+/// events per millisecond are dispatched to all of their subscribers. One scenario batches its type (see
+/// AsyncEventBus::EnableBatching()), and one runs every subscriber on a strand of its own (see
+/// AsyncEventBus::SubscribeOrdered()), for comparison with the same subscriber count dispatched one event per job.
+class EventBusBenchmark
+{
+public:
+    /// @brief Launches the benchmark on a background thread so the UI keeps rendering.
+    void Start();
+
+    /// @brief Returns true while the benchmark thread is still measuring.
+    bool IsRunning() const { return m_Running.load(); }
+
+    /// @brief Draws the controls and result plots inside the current ImGui window.
+    void OnImGuiRender();
+
+private:
+    /// @brief Subscribes the handlers of a scenario to its event type. Done once.
+    template <std::size_t Index> void SubscribeScenario();
+
+    /// @brief Publishes kEventsPerRun events from several threads and waits until every one was dispatched.
+    /// @tparam Index The scenario to run, as an index into kScenarios.
+    /// @param publisherCount The number of threads publishing concurrently.
+    /// @return The throughput in events per millisecond.
+    template <std::size_t Index> float RunScenario(unsigned int publisherCount);
+
+    /// @brief The value m_Dispatched reaches once a run of the scenario is complete.
+    template <std::size_t Index> static constexpr int GetExpectedCount()
+    {
+        return kScenarios[Index].Ordered ? kEventsPerRun * kScenarios[Index].Subscribers : kEventsPerRun;
+    }
+
+private:
+    /// @brief The subscribers of one event type, and whether its events are batched or its handlers ordered.
+    struct Scenario
+    {
+        int  Subscribers;
+        bool Batched;
+        bool Ordered;
+    };
+
+    static constexpr std::array<Scenario, 6> kScenarios = {{{1, false, false},
+                                                            {4, false, false},
+                                                            {16, false, false},
+                                                            {64, false, false},
+                                                            {16, true, false},
+                                                            {16, false, true}}};
+    static constexpr int         kEventsPerRun = 50000;
+    static constexpr std::size_t kBatchSize    = 256;
+
+    std::atomic<bool> m_Running    = false;
+    bool              m_Subscribed = false;
+
+    // Incremented by the last subscriber of every event, so it counts fully dispatched events. Ordered subscribers
+    // run on strands of their own, so there each of them counts.
+    std::atomic<int> m_Dispatched = 0;
+
+    // Results, written by the benchmark thread and read by the UI.
+    // Plotted per scenario: one value per publisher thread count.
+    std::mutex                                        m_ResultMutex;
+    std::vector<float>                                m_PublisherCounts;
+    std::array<std::vector<float>, kScenarios.size()> m_EventsPerMs;
+
+    // Declared last so it is joined before the results are destroyed.
+    std::jthread m_Thread;
+};
@@ -24,13 +24,21 @@ void CircularWave3DLayer::OnUpdate(Nodens::TimeStep previous_update_duration)
 {
     ZoneScoped;
 
+    // Split the per-point update across the job system. Each chunk runs a tight loop over
+    // kGrainSize points; the main thread processes chunks too instead of idling.
     constexpr float kIncrement = 0.001f;
-    for (int i = 0; i < kNumberOfPoints; i++)
-    {
-        t[i] += kIncrement;
-        xs[i] = std::sin(kFrequency * t[i]);
-        ys[i] = std::cos(kFrequency * t[i]);
-    }
+    Nodens::Application::Get().GetJobSystem().ParallelFor(0,
+                                                           kNumberOfPoints,
+                                                           kGrainSize,
+                                                           [this](size_t begin, size_t end)
+                                                           {
+                                                               for (size_t i = begin; i < end; i++)
+                                                               {
+                                                                   t[i] += kIncrement;
+                                                                   xs[i] = std::sin(kFrequency * t[i]);
+                                                                   ys[i] = std::cos(kFrequency * t[i]);
+                                                               }
+                                                           });
 } // CircularWave3DLayer::OnUpdate
 
 void CircularWave3DLayer::OnImGuiRender(Nodens::TimeStep ts)
@@ -33,6 +33,7 @@ public:
 
 private:
     static constexpr size_t kNumberOfPoints = 1000;
+    static constexpr size_t kGrainSize      = 256; // Points per ParallelFor chunk
 
     float kFrequency = 5.f * std::numbers::pi_v<float>;
     float t[kNumberOfPoints], xs[kNumberOfPoints], ys[kNumberOfPoints];
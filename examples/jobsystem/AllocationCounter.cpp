@@ -0,0 +1,58 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+static thread_local uint64_t t_Allocations = 0;
+
+uint64_t AllocationCounter::GetThreadAllocations()
+{
+    return t_Allocations;
+}
+
+// Replacing the throwing/aligned forms is enough: the remaining overloads forward to these.
+void* operator new(std::size_t size)
+{
+    t_Allocations++;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    t_Allocations++;
+    std::size_t align = static_cast<std::size_t>(alignment);
+#ifdef _MSC_VER
+    if (void* ptr = _aligned_malloc(size ? size : 1, align))
+        return ptr;
+#else
+    if (void* ptr = std::aligned_alloc(align, ((size ? size : 1) + align - 1) / align * align))
+        return ptr;
+#endif
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    operator delete(ptr, std::align_val_t{});
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+/// @brief Counts heap allocations made by the calling thread.
+/// The example replaces the global operator new so the benchmark can verify that a code path does not allocate.
+namespace AllocationCounter
+{
+/// @brief Gets the number of operator new calls performed so far by the calling thread.
+uint64_t GetThreadAllocations();
+} // namespace AllocationCounter
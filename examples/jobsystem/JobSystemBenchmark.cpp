@@ -0,0 +1,417 @@
+#include "JobSystemBenchmark.h"
+
+#include "AllocationCounter.h"
+
+#include <imgui.h>
+#include <implot.h>
+
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <ranges>
+
+#ifdef ND_PLATFORM_WINDOWS
+    #include <Windows.h>
+#endif
+
+// A small, purely arithmetic payload so the benchmark measures scheduling overhead and scaling,
+// not memory bandwidth.
+static float BusyWork(int iterations)
+{
+    float value = 0.0f;
+    for (int i = 0; i < iterations; ++i)
+        value += std::sin(static_cast<float>(i)) * 0.5f;
+    return value;
+}
+
+// CPU time consumed by the whole process so far, in seconds.
+static double GetProcessCpuSeconds()
+{
+#ifdef ND_PLATFORM_WINDOWS
+    FILETIME creation, exit, kernel, user;
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    auto toSeconds = [](const FILETIME& time)
+    { return ((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 1e-7; };
+    return toSeconds(kernel) + toSeconds(user);
+#else
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+void JobSystemBenchmark::Start()
+{
+    if (m_Running.exchange(true))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_ResultMutex);
+        m_ThreadCounts.clear();
+        m_Speedups.clear();
+        m_JobsPerMs.clear();
+        m_AllocsPerSubmit         = -1.0f;
+        m_AllocsPerDetachedSubmit = -1.0f;
+        m_CriticalLatencyIdle     = -1.0f;
+        m_CriticalLatencyLoaded   = -1.0f;
+        m_LoopSubmitNs            = -1.0f;
+        m_BatchSubmitNs           = -1.0f;
+        m_IdleResults.clear();
+    }
+
+    m_Thread = std::jthread(
+        [this](std::stop_token stoken)
+        {
+            tracy::SetThreadName("Benchmark");
+
+            {
+                float detached = MeasureAllocationsPerSubmit(true);
+                float future   = MeasureAllocationsPerSubmit(false);
+
+                std::lock_guard<std::mutex> lock(m_ResultMutex);
+                m_AllocsPerDetachedSubmit = detached;
+                m_AllocsPerSubmit         = future;
+            }
+
+            {
+                float idle   = MeasureCriticalLatency(false);
+                float loaded = MeasureCriticalLatency(true);
+
+                std::lock_guard<std::mutex> lock(m_ResultMutex);
+                m_CriticalLatencyIdle   = idle;
+                m_CriticalLatencyLoaded = loaded;
+            }
+
+            {
+                float loop  = MeasureFanOutSubmitCost(false);
+                float batch = MeasureFanOutSubmitCost(true);
+
+                std::lock_guard<std::mutex> lock(m_ResultMutex);
+                m_LoopSubmitNs  = loop;
+                m_BatchSubmitNs = batch;
+            }
+
+            {
+                using namespace std::chrono_literals;
+                std::vector<IdleResult> results;
+                results.push_back(MeasureIdleStrategy("Park immediately", {.SpinTime = 0us, .YieldTime = 0us}));
+                results.push_back(MeasureIdleStrategy("Default", {}));
+                results.push_back(MeasureIdleStrategy("Spin 1 ms", {.SpinTime = 1000us, .YieldTime = 0us}));
+
+                std::lock_guard<std::mutex> lock(m_ResultMutex);
+                m_IdleResults = std::move(results);
+            }
+
+            const unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+            double             baseline   = 0.0;
+
+            for (unsigned int threads = 1; threads <= maxThreads && !stoken.stop_requested(); ++threads)
+            {
+                double elapsed = RunScenario(threads);
+                if (threads == 1)
+                    baseline = elapsed;
+
+                const float totalJobs = static_cast<float>(kRootJobs * (kChildrenPerJob + 1));
+
+                std::lock_guard<std::mutex> lock(m_ResultMutex);
+                m_ThreadCounts.push_back(static_cast<float>(threads));
+                m_Speedups.push_back(static_cast<float>(baseline / elapsed));
+                m_JobsPerMs.push_back(totalJobs / static_cast<float>(elapsed));
+            }
+
+            m_Running = false;
+        });
+}
+
+double JobSystemBenchmark::RunScenario(unsigned int threadCount)
+{
+    ZoneScopedN("Benchmark Scenario");
+
+    Nodens::JobSystem jobSystem(threadCount);
+
+    std::atomic<int> remaining = kRootJobs * (kChildrenPerJob + 1);
+    auto             finish    = [&remaining]()
+    {
+        if (remaining.fetch_sub(1) == 1)
+            remaining.notify_all();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < kRootJobs; ++i)
+    {
+        // Root jobs land in the injection queue, their children in the worker's local deque.
+        jobSystem.Submit(
+            [&jobSystem, &finish]()
+            {
+                for (int c = 0; c < kChildrenPerJob; ++c)
+                {
+                    jobSystem.Submit(
+                        [&finish]()
+                        {
+                            volatile float sink = BusyWork(kWorkPerJob);
+                            (void)sink;
+                            finish();
+                        });
+                }
+                finish();
+            });
+    }
+
+    // Wait for the last job to report back.
+    for (int value = remaining.load(); value != 0; value = remaining.load())
+        remaining.wait(value);
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+float JobSystemBenchmark::MeasureAllocationsPerSubmit(bool detached)
+{
+    ZoneScopedN("Benchmark Allocations");
+
+    constexpr int kWarmupJobs   = 4096;
+    constexpr int kMeasuredJobs = 16384;
+
+    Nodens::JobSystem              jobSystem;
+    std::atomic<int>               remaining = kWarmupJobs + kMeasuredJobs;
+    std::vector<std::future<void>> futures;
+    futures.reserve(kWarmupJobs + kMeasuredJobs);
+
+    auto job = [&remaining]()
+    {
+        if (remaining.fetch_sub(1) == 1)
+            remaining.notify_all();
+    };
+
+    auto submit = [&](int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            if (detached)
+                jobSystem.SubmitDetached(job);
+            else
+                futures.push_back(jobSystem.Submit(job));
+        }
+    };
+
+    // Warm up the job pool so chunk allocations are not attributed to the steady state.
+    submit(kWarmupJobs);
+
+    uint64_t before = AllocationCounter::GetThreadAllocations();
+    submit(kMeasuredJobs);
+    uint64_t after = AllocationCounter::GetThreadAllocations();
+
+    for (int value = remaining.load(); value != 0; value = remaining.load())
+        remaining.wait(value);
+
+    return static_cast<float>(after - before) / kMeasuredJobs;
+}
+
+float JobSystemBenchmark::MeasureFanOutSubmitCost(bool batch)
+{
+    ZoneScopedN("Benchmark Fan-Out Submission");
+
+    constexpr int kRounds = 64;
+
+    Nodens::JobSystem        jobSystem;
+    std::atomic<int>         sink = 0;
+    std::chrono::nanoseconds submitTime{0};
+
+    auto job = [&sink]() { sink.fetch_add(1, std::memory_order_relaxed); };
+
+    for (int round = 0; round < kRounds; ++round)
+    {
+        Nodens::JobCounter counter;
+
+        auto start = std::chrono::steady_clock::now();
+        if (batch)
+        {
+            jobSystem.SubmitBatch(counter, std::views::iota(0, kFanOutJobs) |
+                                               std::views::transform([&job](int) { return job; }));
+        }
+        else
+        {
+            for (int i = 0; i < kFanOutJobs; ++i)
+                jobSystem.SubmitDetached(counter, job);
+        }
+        submitTime += std::chrono::steady_clock::now() - start;
+
+        // Let the workers drain the fan-out and park again, so every round starts from sleeping workers.
+        jobSystem.Wait(counter);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return static_cast<float>(submitTime.count()) / (kRounds * kFanOutJobs);
+}
+
+float JobSystemBenchmark::MeasureCriticalLatency(bool backgroundLoad)
+{
+    ZoneScopedN("Benchmark Critical Latency");
+
+    constexpr int kBackgroundJobs = 50000;
+    constexpr int kProbes         = 200;
+
+    Nodens::JobSystem jobSystem;
+
+    // Keep every worker busy with far more background work than the probes take. Whatever is left when the
+    // measurement ends is discarded by the JobSystem destructor.
+    if (backgroundLoad)
+    {
+        for (int i = 0; i < kBackgroundJobs; ++i)
+        {
+            jobSystem.SubmitDetached({.Priority = Nodens::JobPriority::Background},
+                                     []()
+                                     {
+                                         volatile float sink = BusyWork(kWorkPerJob);
+                                         (void)sink;
+                                     });
+        }
+    }
+
+    // Declared outside the loop: the probe may still be notifying when the next iteration starts.
+    std::atomic<int> probesStarted     = 0;
+    double           totalMicroseconds = 0.0;
+    for (int i = 0; i < kProbes; ++i)
+    {
+        double latency = 0.0;
+        auto   submit  = std::chrono::steady_clock::now();
+
+        jobSystem.SubmitDetached({.Priority = Nodens::JobPriority::Critical},
+                                 [&]()
+                                 {
+                                     std::chrono::duration<double, std::micro> elapsed =
+                                         std::chrono::steady_clock::now() - submit;
+                                     latency = elapsed.count();
+                                     probesStarted.fetch_add(1);
+                                     probesStarted.notify_one();
+                                 });
+
+        probesStarted.wait(i);
+        totalMicroseconds += latency;
+    }
+
+    return static_cast<float>(totalMicroseconds / kProbes);
+}
+
+JobSystemBenchmark::IdleResult JobSystemBenchmark::MeasureIdleStrategy(const char*                      name,
+                                                                        const Nodens::JobSystemConfig& config)
+{
+    ZoneScopedN("Benchmark Idle Strategy");
+
+    constexpr int  kProbes        = 1000;
+    constexpr auto kProbeGap      = std::chrono::microseconds(50);
+    constexpr int  kTrickleJobs   = 200;
+    constexpr auto kTricklePeriod = std::chrono::milliseconds(2);
+
+    Nodens::JobSystem jobSystem(config);
+
+    // 1. Latency: jobs arrive shortly after the workers ran out of work, as within a frame.
+    std::atomic<int> probesStarted     = 0;
+    double           totalMicroseconds = 0.0;
+    for (int i = 0; i < kProbes; ++i)
+    {
+        // Busy-wait the gap, sleeping is far too coarse at this scale.
+        auto resume = std::chrono::steady_clock::now() + kProbeGap;
+        while (std::chrono::steady_clock::now() < resume)
+        {
+        }
+
+        double latency = 0.0;
+        auto   submit  = std::chrono::steady_clock::now();
+        jobSystem.SubmitDetached(
+            [&]()
+            {
+                std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - submit;
+                latency                                           = elapsed.count();
+                probesStarted.fetch_add(1);
+                probesStarted.notify_one();
+            });
+
+        probesStarted.wait(i);
+        totalMicroseconds += latency;
+    }
+
+    // 2. Idle CPU: a trickle of tiny jobs, so the workers spend nearly all their time idling. This includes
+    // whatever the rest of the process (e.g. rendering) burns meanwhile, so compare the rows, not the values.
+    double cpuStart  = GetProcessCpuSeconds();
+    auto   wallStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < kTrickleJobs; ++i)
+    {
+        jobSystem.SubmitDetached([]() {});
+        std::this_thread::sleep_for(kTricklePeriod);
+    }
+    double cpuSeconds = GetProcessCpuSeconds() - cpuStart;
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wallStart;
+
+    return {name, static_cast<float>(totalMicroseconds / kProbes), static_cast<float>(cpuSeconds / wall.count())};
+}
+
+void JobSystemBenchmark::OnImGuiRender()
+{
+    if (IsRunning())
+    {
+        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Benchmark running...");
+    }
+    else if (ImGui::Button("Run Scaling Benchmark"))
+    {
+        Start();
+    }
+
+    std::lock_guard<std::mutex> lock(m_ResultMutex);
+    if (m_AllocsPerSubmit >= 0.0f)
+    {
+        Nodens::JobAllocationStats stats = Nodens::JobSystem::GetAllocationStats();
+        ImGui::Text("Heap allocations per Submit():         %.3f", m_AllocsPerSubmit);
+        ImGui::Text("Heap allocations per SubmitDetached(): %.3f", m_AllocsPerDetachedSubmit);
+        ImGui::Text("Job pool: %llu slots, %llu heap allocations",
+                    (unsigned long long)stats.SlotCapacity,
+                    (unsigned long long)stats.GetHeapAllocations());
+    }
+    if (m_CriticalLatencyIdle >= 0.0f)
+    {
+        ImGui::Text("Critical job start latency, idle:            %.1f us", m_CriticalLatencyIdle);
+        ImGui::Text("Critical job start latency, background load: %.1f us", m_CriticalLatencyLoaded);
+    }
+    if (m_LoopSubmitNs >= 0.0f)
+    {
+        ImGui::Text("Fan-out of %d jobs, SubmitDetached() loop: %.1f ns per job", kFanOutJobs, m_LoopSubmitNs);
+        ImGui::Text("Fan-out of %d jobs, SubmitBatch():         %.1f ns per job", kFanOutJobs, m_BatchSubmitNs);
+    }
+    if (!m_IdleResults.empty() && ImGui::BeginTable("Idle Strategies", 3, ImGuiTableFlags_Borders))
+    {
+        ImGui::TableSetupColumn("Idle strategy");
+        ImGui::TableSetupColumn("Start latency (us)");
+        ImGui::TableSetupColumn("CPU while idle (cores)");
+        ImGui::TableHeadersRow();
+        for (const IdleResult& result : m_IdleResults)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(result.Name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", result.LatencyUs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", result.CpuCores);
+        }
+        ImGui::EndTable();
+    }
+
+    if (ImPlot::BeginPlot("Speedup vs Workers", ImVec2(-1, 200)))
+    {
+        ImPlot::SetupAxes("Workers", "Speedup (x)", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        if (!m_ThreadCounts.empty())
+        {
+            ImPlot::PlotLine("Measured", m_ThreadCounts.data(), m_Speedups.data(), (int)m_ThreadCounts.size());
+            ImPlot::PlotLine("Ideal", m_ThreadCounts.data(), m_ThreadCounts.data(), (int)m_ThreadCounts.size());
+        }
+        ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot("Throughput", ImVec2(-1, 200)))
+    {
+        ImPlot::SetupAxes("Workers", "Jobs / ms", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        if (!m_ThreadCounts.empty())
+        {
+            ImPlot::PlotBars("Jobs / ms", m_ThreadCounts.data(), m_JobsPerMs.data(), (int)m_ThreadCounts.size(), 0.5);
+        }
+        ImPlot::EndPlot();
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "nodens.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief Scaling benchmark for the Nodens::JobSystem.
+/// Runs the same fine-grained workload on a fresh JobSystem with 1..N workers and plots the speedup.
+/// Every root job fans out nested jobs, so both the injection queue and the local deques/stealing are exercised.
+class JobSystemBenchmark
+{
+public:
+    /// @brief Launches the benchmark on a background thread so the UI keeps rendering.
+    void Start();
+
+    /// @brief Returns true while the benchmark thread is still measuring.
+    bool IsRunning() const { return m_Running.load(); }
+
+    /// @brief Draws the controls and result plots inside the current ImGui window.
+    void OnImGuiRender();
+
+private:
+    /// @brief Runs the workload once and returns the elapsed wall time in milliseconds.
+    /// @param threadCount The number of workers the temporary JobSystem is created with.
+    static double RunScenario(unsigned int threadCount);
+
+    /// @brief Measures how many heap allocations the submitting thread performs per job.
+    /// @param detached Whether to measure SubmitDetached() (fire-and-forget) or Submit() (future-based).
+    static float MeasureAllocationsPerSubmit(bool detached);
+
+    /// @brief Measures the mean time from submission to start of critical-priority jobs, in microseconds.
+    /// @param backgroundLoad Whether the workers are flooded with background jobs meanwhile.
+    static float MeasureCriticalLatency(bool backgroundLoad);
+
+    /// @brief Measures the submitting thread's time per job of a fan-out, in nanoseconds.
+    /// @param batch Whether the fan-out uses SubmitBatch() or SubmitDetached() in a loop.
+    static float MeasureFanOutSubmitCost(bool batch);
+
+    /// @brief Result of one idle strategy run.
+    struct IdleResult
+    {
+        const char* Name;
+        float       LatencyUs; ///< Mean submit-to-start latency of sporadic jobs.
+        float       CpuCores;  ///< Process CPU time per wall time while jobs only trickle in.
+    };
+
+    /// @brief Measures the submit-to-start latency and the idle CPU cost of a worker idle configuration.
+    static IdleResult MeasureIdleStrategy(const char* name, const Nodens::JobSystemConfig& config);
+
+private:
+    static constexpr int kRootJobs       = 512;
+    static constexpr int kChildrenPerJob = 16;
+    static constexpr int kWorkPerJob     = 2000;
+    static constexpr int kFanOutJobs     = 512;
+
+    std::atomic<bool> m_Running = false;
+
+    // Results, written by the benchmark thread and read by the UI.
+    std::mutex              m_ResultMutex;
+    std::vector<float>      m_ThreadCounts;
+    std::vector<float>      m_Speedups;
+    std::vector<float>      m_JobsPerMs;
+    float                   m_AllocsPerSubmit         = -1.0f;
+    float                   m_AllocsPerDetachedSubmit = -1.0f;
+    float                   m_CriticalLatencyIdle     = -1.0f;
+    float                   m_CriticalLatencyLoaded   = -1.0f;
+    float                   m_LoopSubmitNs            = -1.0f;
+    float                   m_BatchSubmitNs           = -1.0f;
+    std::vector<IdleResult> m_IdleResults;
+
+    // Declared last so it is joined before the results are destroyed.
+    std::jthread m_Thread;
+};
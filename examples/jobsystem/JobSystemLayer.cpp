@@ -2,11 +2,121 @@
 
 #include <imgui.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <numeric>
+#include <random>
 #include <thread>
 
 JobSystemLayer::JobSystemLayer() : Layer("JobSystemLayer") {}
 
+void JobSystemLayer::OnAttach()
+{
+    // ==============================================================
+    // BUILD ONCE: Declare the nodes and their dependencies
+    // ==============================================================
+    m_Graph = std::make_unique<Nodens::JobGraph>(Nodens::Application::Get().GetJobSystem());
+
+    auto generate = m_Graph->AddNode("Generate",
+                                     [this]()
+                                     {
+                                         std::mt19937                    generator(m_GraphRuns);
+                                         std::normal_distribution<float> dist(50.0f, 15.0f);
+                                         m_Samples.resize(200000);
+                                         for (float& sample : m_Samples)
+                                             sample = dist(generator);
+                                     });
+
+    // Sort and Statistics only read the samples, so they can run at the same time.
+    auto sort = m_Graph->AddNode("Sort",
+                                 [this]()
+                                 {
+                                     std::vector<float> sorted = m_Samples;
+                                     auto               middle = sorted.begin() + sorted.size() / 2;
+                                     std::nth_element(sorted.begin(), middle, sorted.end());
+                                     m_Median = *middle;
+                                 });
+
+    auto statistics = m_Graph->AddNode("Statistics",
+                                       [this]()
+                                       {
+                                           float sum = std::accumulate(m_Samples.begin(), m_Samples.end(), 0.0f);
+                                           m_Mean    = sum / static_cast<float>(m_Samples.size());
+                                       });
+
+    auto summary = m_Graph->AddNode("Summary", [this]() { m_Spread = std::abs(m_Mean - m_Median); });
+
+    m_Graph->AddEdge(generate, sort);
+    m_Graph->AddEdge(generate, statistics);
+    m_Graph->AddEdge(sort, summary);
+    m_Graph->AddEdge(statistics, summary);
+
+    // ==============================================================
+    // PIPELINE: Stream records through bounded stages
+    // ==============================================================
+    // Two tokens per thread keep every core busy while at most that many records exist at once.
+    auto& jobSystem = Nodens::Application::Get().GetJobSystem();
+    m_Pipeline = std::make_unique<Nodens::Pipeline<IngestRecord>>(jobSystem, 2 * (jobSystem.GetWorkerCount() + 1));
+
+    m_Pipeline->SetSource(
+        [this](IngestRecord& record)
+        {
+            if (m_IngestProduced == kIngestRecords)
+                return false;
+            record.Index = m_IngestProduced++;
+            record.Line  = "sensor-" + std::to_string(record.Index % 64) + "," + std::to_string(record.Index % 1000);
+            return true;
+        });
+
+    m_Pipeline->AddStage("Parse", Nodens::StageMode::Parallel,
+                         [](IngestRecord& record)
+                         {
+                             const std::size_t comma = record.Line.find(',');
+                             record.Reading          = std::stof(record.Line.substr(comma + 1)) * 0.1f;
+                         });
+
+    m_Pipeline->AddStage("Score", Nodens::StageMode::Parallel,
+                         [](IngestRecord& record)
+                         {
+                             float score = 0.0f;
+                             for (int i = 1; i <= 64; ++i)
+                                 score += std::sin(record.Reading * static_cast<float>(i)) / static_cast<float>(i);
+                             record.Score = score;
+                         });
+
+    // Serial stages see the records in source order, whichever order the parallel stages finished them in.
+    m_Pipeline->AddStage("Aggregate", Nodens::StageMode::Serial,
+                         [this](IngestRecord& record)
+                         {
+                             m_IngestInOrder = m_IngestInOrder && record.Index == m_IngestNext;
+                             m_IngestNext++;
+                             m_IngestTotal += record.Score;
+                             if (m_IngestNext == kIngestRecords)
+                             {
+                                 auto elapsed = std::chrono::steady_clock::now() - m_IngestStart;
+                                 m_IngestMs   = std::chrono::duration<float, std::milli>(elapsed).count();
+                             }
+                         });
+
+    // ==============================================================
+    // TIMERS: A heartbeat job every 250 ms, fired by the timer thread
+    // ==============================================================
+    m_HeartbeatTimer = jobSystem.SubmitEvery(
+        std::chrono::milliseconds(250), [this]() { m_Heartbeats.fetch_add(1, std::memory_order_relaxed); });
+}
+
+void JobSystemLayer::OnDetach()
+{
+    // Destroying the pipeline waits for a run in progress. Also called when the application exits, while the job
+    // system is still alive.
+    m_Pipeline.reset();
+
+    auto& jobSystem = Nodens::Application::Get().GetJobSystem();
+    jobSystem.CancelTimer(m_HeartbeatTimer);
+    jobSystem.CancelTimer(m_DelayedTimer);
+}
+
 void JobSystemLayer::OnUpdate(Nodens::TimeStep ts)
 {
     m_TimePassed += ts;
@@ -14,14 +124,13 @@ void JobSystemLayer::OnUpdate(Nodens::TimeStep ts)
     // ==============================================================
     // POLL: Check if the background job is finished
     // ==============================================================
-    // We use wait_for with 0 seconds to check status without blocking
-    // the rendering thread.
-    if (m_IsJobRunning && m_JobFuture.valid())
+    // IsReady() checks the status without blocking the rendering thread.
+    if (m_IsJobRunning && m_JobHandle.IsValid())
     {
-        if (m_JobFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        if (m_JobHandle.IsReady())
         {
-            // 1. Retrieve the result (this moves the data to main thread)
-            m_JobResult = m_JobFuture.get();
+            // 1. Retrieve the result (the job has finished, so this does not wait)
+            m_JobResult = m_JobHandle.Get();
 
             // 2. Mark as done
             m_IsJobRunning = false;
@@ -37,6 +146,10 @@ void JobSystemLayer::OnImGuiRender(Nodens::TimeStep ts)
     ImGui::Text(
         "Application Average: %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
     ImGui::Text("Active Time: %.2f s", m_TimePassed);
+
+    auto& jobSystem = Nodens::Application::Get().GetJobSystem();
+    ImGui::Text("Compute workers: %u | Blocking threads: %u", jobSystem.GetWorkerCount(),
+                jobSystem.GetBlockingThreadCount());
     ImGui::Separator();
 
     if (m_IsJobRunning)
@@ -52,9 +165,9 @@ void JobSystemLayer::OnImGuiRender(Nodens::TimeStep ts)
             m_IsJobRunning = true;
             m_JobResult    = 0;
 
-            auto& jobSystem = Nodens::Application::Get().GetJobSystem();
-
-            m_JobFuture = jobSystem.Submit(
+            // The job only sleeps, so it runs on the blocking pool and leaves the compute workers alone
+            m_JobHandle = jobSystem.Spawn(
+                {.Pool = Nodens::WorkerPool::Blocking},
                 []()
                 {
                     ZoneScopedN("Heavy Calculation");
@@ -71,6 +184,85 @@ void JobSystemLayer::OnImGuiRender(Nodens::TimeStep ts)
     ImGui::Separator();
     ImGui::Text("Result from Thread: %d", m_JobResult);
     ImGui::End();
+
+    // ==============================================================
+    // JOB GRAPH: Re-executed on demand, completion checked without futures
+    // ==============================================================
+    ImGui::Begin("Job Graph");
+    bool graphComplete = m_Graph->IsComplete();
+    if (graphComplete)
+    {
+        if (ImGui::Button("Execute Graph"))
+        {
+            m_GraphRuns++;
+            m_GraphShown = m_Graph->Execute();
+        }
+    }
+    else
+    {
+        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "STATUS: Graph running...");
+    }
+
+    ImGui::Text("Generate -> (Sort, Statistics) -> Summary");
+    if (m_GraphShown && graphComplete)
+    {
+        ImGui::Text("Run #%d: mean %.3f | median %.3f | spread %.4f", m_GraphRuns, m_Mean, m_Median, m_Spread);
+    }
+    ImGui::End();
+
+    // ==============================================================
+    // PIPELINE: Bounded streaming, completion checked without blocking
+    // ==============================================================
+    ImGui::Begin("Ingest Pipeline");
+    ImGui::Text("Generate -> Parse (parallel) -> Score (parallel) -> Aggregate (serial)");
+    ImGui::Text("%zu records in flight at most", m_Pipeline->GetTokenCount());
+    if (m_Pipeline->IsComplete())
+    {
+        if (ImGui::Button("Ingest 200k Records"))
+        {
+            m_IngestProduced = 0;
+            m_IngestNext     = 0;
+            m_IngestInOrder  = true;
+            m_IngestTotal    = 0.0;
+            m_IngestStart    = std::chrono::steady_clock::now();
+            m_IngestShown    = m_Pipeline->Run();
+        }
+        if (m_IngestShown)
+        {
+            ImGui::Text("%d records in %.1f ms | in order: %s | total score %.2f", m_IngestNext, m_IngestMs,
+                        m_IngestInOrder ? "yes" : "NO", m_IngestTotal);
+        }
+    }
+    else
+    {
+        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "STATUS: Ingesting...");
+    }
+    ImGui::End();
+
+    // ==============================================================
+    // TIMERS: Delayed and periodic jobs without sleeping threads
+    // ==============================================================
+    ImGui::Begin("Timers");
+    ImGui::Text("Heartbeats (every 250 ms): %d", m_Heartbeats.load(std::memory_order_relaxed));
+    if (ImGui::Button("Submit Job in 2 s"))
+    {
+        jobSystem.CancelTimer(m_DelayedTimer);
+        m_DelayedFired = false;
+        m_DelayedTimer = jobSystem.SubmitAfter(std::chrono::seconds(2), [this]() { m_DelayedFired = true; });
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Cancel"))
+    {
+        jobSystem.CancelTimer(m_DelayedTimer);
+    }
+    ImGui::Text("Delayed job: %s", m_DelayedFired ? "fired" : "waiting or cancelled");
+    ImGui::End();
+
+    ImGui::Begin("Job System Benchmark");
+    m_Benchmark.OnImGuiRender();
+    ImGui::End();
+
+    m_TelemetryPanel.OnImGuiRender(jobSystem);
 }
 
 void JobSystemLayer::OnEvent(Nodens::Event& e) {}
\ No newline at end of file
@@ -1,11 +1,17 @@
 #pragma once
 
+#include "JobSystemBenchmark.h"
 #include "nodens.h"
 
-#include <future>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
 
 /// @brief Layer for the JobSystem example.
-/// This layer demonstrates how to use the Nodens::JobSystem to run a background task.
+/// This layer demonstrates how to use the Nodens::JobSystem to run a background task,
+/// how to chain dependent jobs with a Nodens::JobGraph, and how to stream data through a Nodens::Pipeline.
 class JobSystemLayer : public Nodens::Layer
 {
 public:
@@ -15,6 +21,14 @@ public:
     /// @brief Destroys the JobSystemLayer.
     virtual ~JobSystemLayer() = default;
 
+    /// @brief Called when the layer is attached to the layer stack.
+    /// The job graph is built here, once, and re-executed on demand.
+    virtual void OnAttach() override;
+
+    /// @brief Called when the layer is removed from the layer stack.
+    /// The heartbeat timer is stopped here.
+    virtual void OnDetach() override;
+
     /// @brief Called every frame to update the layer.
     /// We check for job completion here.
     /// @param ts The time since the last frame.
@@ -30,10 +44,52 @@ public:
     virtual void OnEvent(Nodens::Event& e) override;
 
 private:
-    // The future holds the result of our background task
-    std::future<int> m_JobFuture;
+    // The handle holds the result of our background task
+    Nodens::JobHandle<int> m_JobHandle;
 
     bool  m_IsJobRunning = false;
     int   m_JobResult    = 0;
     float m_TimePassed   = 0.0f;
+
+    // Dependency graph: Generate -> (Sort, Statistics) -> Summary
+    std::unique_ptr<Nodens::JobGraph> m_Graph;
+    std::vector<float>                m_Samples;
+    float                             m_Median     = 0.0f;
+    float                             m_Mean       = 0.0f;
+    float                             m_Spread     = 0.0f;
+    int                               m_GraphRuns  = 0;
+    bool                              m_GraphShown = false;
+
+    // Ingest pipeline: Generate (source) -> Parse (parallel) -> Score (parallel) -> Aggregate (serial, in order)
+    struct IngestRecord
+    {
+        std::string Line;
+        int         Index   = 0;
+        float       Reading = 0.0f;
+        float       Score   = 0.0f;
+    };
+    static constexpr int kIngestRecords = 200000;
+
+    int                                   m_IngestProduced = 0;
+    int                                   m_IngestNext     = 0;
+    bool                                  m_IngestInOrder  = true;
+    double                                m_IngestTotal    = 0.0;
+    std::chrono::steady_clock::time_point m_IngestStart;
+    float                                 m_IngestMs    = 0.0f;
+    bool                                  m_IngestShown = false;
+
+    // Declared after the state its stages write, so it is destroyed (and waited for) first.
+    std::unique_ptr<Nodens::Pipeline<IngestRecord>> m_Pipeline;
+
+    // Timers: a periodic heartbeat and a cancellable delayed job, no thread sleeps for either
+    Nodens::TimerHandle m_HeartbeatTimer;
+    Nodens::TimerHandle m_DelayedTimer;
+    std::atomic<int>    m_Heartbeats   = 0;
+    std::atomic<bool>   m_DelayedFired = false;
+
+    // Scaling benchmark shown in its own window
+    JobSystemBenchmark m_Benchmark;
+
+    // Live per-worker telemetry of the application's job system
+    Nodens::JobSystemPanel m_TelemetryPanel;
 };
\ No newline at end of file
@@ -2,12 +2,17 @@
 
 #include "Nodens/Application.h"
 #include "Nodens/Input.h"
+#include "Nodens/JobGraph.h"
 #include "Nodens/KeyCodes.h"
 #include "Nodens/Layer.h"
 #include "Nodens/Log.h"
 #include "Nodens/MouseButtonCodes.h"
+#include "Nodens/Pipeline.h"
+#include "Nodens/Strand.h"
+#include "Nodens/Task.h"
 #include "Nodens/TimeStep.h"
 #include "Nodens/imgui/ImGuiLayer.h"
+#include "Nodens/imgui/JobSystemPanel.h"
 
 // Vendor libraries that users will interact directly with
 #include <imgui.h>
@@ -4,8 +4,10 @@
 #include <ranges>
 
 #include "Events/ApplicationEvent.h"
+#include "Events/AsyncEventBus.h"
 #include "Input.h"
 #include "Log.h"
+#include "Memory/ScratchArena.h"
 #include "Platform/OpenGL/OpenGLImGuiRenderer.h"
 #include "ndpch.h"
 
@@ -14,7 +16,7 @@ namespace Nodens
 
 Application* Application::s_Instance = nullptr;
 
-Application::Application(const WindowProps& props)
+Application::Application(const WindowProps& props, const JobSystemConfig& jobConfig)
 {
     ZoneScoped;
 
@@ -23,7 +25,7 @@ Application::Application(const WindowProps& props)
     s_Instance = this;
 
     // Initialize subsystems
-    m_JobSystem = std::make_unique<JobSystem>();
+    m_JobSystem = std::make_unique<JobSystem>(jobConfig);
 
     // Create the window using the passed properties (or defaults)
     // Window::Create returns a raw pointer, which we immediately wrap in a unique_ptr for ownership.
@@ -43,7 +45,11 @@ Application::Application(const WindowProps& props)
 Application::~Application()
 {
     ZoneScoped;
-    // Cleanup logic if necessary (e.g. if LayerStack doesn't own layers)
+
+    // Detach the layers top-down while the window and the job system are still alive; the LayerStack deletes them
+    // afterwards, still before the job system is destroyed.
+    for (Layer* layer : m_LayerStack | std::views::reverse)
+        layer->OnDetach();
 }
 
 void Application::PushLayer(Layer* layer)
@@ -60,6 +66,27 @@ void Application::PushOverlay(Layer* overlay)
     overlay->OnAttach();
 }
 
+void Application::ResumeNextFrame(std::coroutine_handle<> handle)
+{
+    std::scoped_lock lock(m_FrameCoroutinesMutex);
+    m_FrameCoroutines.push_back(handle);
+}
+
+void Application::ResumeFrameCoroutines()
+{
+    ZoneScoped;
+
+    {
+        std::scoped_lock lock(m_FrameCoroutinesMutex);
+        std::swap(m_FrameCoroutines, m_ResumingCoroutines);
+    }
+
+    // Coroutines that await NextFrame() again while resuming land in the other buffer and wait a frame.
+    for (std::coroutine_handle<> handle : m_ResumingCoroutines)
+        handle.resume();
+    m_ResumingCoroutines.clear();
+}
+
 void Application::Run()
 {
     while (m_Running)
@@ -70,6 +97,12 @@ void Application::Run()
         TimeStep timestep = time - m_LastFrameTime;
         m_LastFrameTime   = time;
 
+        // Continue coroutines that asked to run on the main thread
+        ResumeFrameCoroutines();
+
+        // Take in results posted by workers, as many as the frame budget allows
+        m_MainThreadExecutor.Drain();
+
         // Update each layer
         for (Layer* layer : m_LayerStack)
             layer->OnUpdate(timestep);
@@ -82,6 +115,11 @@ void Application::Run()
 
         m_Window->OnUpdate();
 
+        // Events batched per frame go out once the layers have published them
+        AsyncEventBus::Get().EndFrame();
+
+        // Main-thread scratch memory lives for one frame.
+        ScratchArena::EndFrame();
         FrameMark;
     }
 }
@@ -5,11 +5,15 @@
 #include "Nodens/Events/Event.h"
 #include "Nodens/JobSystem.h"
 #include "Nodens/LayerStack.h"
+#include "Nodens/MainThreadExecutor.h"
 #include "Nodens/TimeStep.h"
 #include "Nodens/imgui/ImGuiLayer.h"
 #include "Window.h"
 
+#include <coroutine>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace Nodens
 {
@@ -23,8 +27,11 @@ public:
      * with custom WindowProps, eliminating code duplication.
      * * @param props The properties for the window (title, width, height, vsync).
      * Defaults to WindowProps() if not provided.
+     * @param jobConfig The worker count and CPU placement of the JobSystem.
+     * Defaults to JobSystemConfig() (unpinned, one core left to the main thread) if not provided.
      */
-    explicit Application(const WindowProps& props = WindowProps());
+    explicit Application(const WindowProps&     props     = WindowProps(),
+                         const JobSystemConfig& jobConfig = JobSystemConfig());
     virtual ~Application();
 
     void Run();
@@ -36,25 +43,63 @@ public:
     inline Window&    GetWindow() { return *m_Window; }
     inline JobSystem& GetJobSystem() { return *m_JobSystem; }
 
+    /// @brief Gets the queue of work posted to the main thread, drained every frame within its budget.
+    /// @code Application::Get().GetMainThreadExecutor().Post([this, result]() { m_Results.push_back(result); });
+    /// @endcode
+    inline MainThreadExecutor& GetMainThreadExecutor() { return m_MainThreadExecutor; }
+
     static inline Application& Get() { return *s_Instance; }
 
+    /// @brief Awaitable that resumes the awaiting coroutine on the main thread (see NextFrame()).
+    struct NextFrameAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const { Application::Get().ResumeNextFrame(handle); }
+        void await_resume() const noexcept {}
+    };
+
+    /// @brief Queues a suspended coroutine to be resumed at the start of the next frame. Thread-safe.
+    void ResumeNextFrame(std::coroutine_handle<> handle);
+
 private:
     bool OnWindowClose(WindowCloseEvent& e);
 
+    /// @brief Resumes the coroutines queued by ResumeNextFrame() before this frame started.
+    void ResumeFrameCoroutines();
+
     bool m_Running = true;
 
+    /// @brief Declared before the job system, so it outlives the workers that post to it.
+    MainThreadExecutor m_MainThreadExecutor;
+
+    /// @brief Declared before the layers, so jobs, graphs and pipelines they own can still wait on it while they
+    /// are detached and destroyed.
+    std::unique_ptr<JobSystem> m_JobSystem;
+
     std::unique_ptr<Window> m_Window;
     ImGuiLayer*             m_ImGuiLayer;
     LayerStack              m_LayerStack;
 
-    std::unique_ptr<JobSystem> m_JobSystem;
-
     float m_LastFrameTime = 0.0f;
 
+    /// @brief Coroutines waiting for the next frame. Swapped with m_ResumingCoroutines each frame, so both
+    /// buffers keep their capacity and the steady state does not allocate.
+    TracyLockable(std::mutex, m_FrameCoroutinesMutex);
+    std::vector<std::coroutine_handle<>> m_FrameCoroutines;
+    std::vector<std::coroutine_handle<>> m_ResumingCoroutines;
+
 private:
     static Application* s_Instance;
 };
 
+/// @brief Suspends the awaiting coroutine and resumes it on the main thread at the start of the next frame,
+/// before the layers are updated. Coroutines still waiting when the application exits are not resumed.
+/// @code co_await NextFrame(); // safe to touch main-thread state again @endcode
+inline Application::NextFrameAwaiter NextFrame()
+{
+    return {};
+}
+
 // To be defined in CLIENT
 Application* CreateApplication();
 
@@ -0,0 +1,182 @@
+#include "BlockingPool.h"
+
+#include "Memory/ScratchArena.h"
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+#include <algorithm>
+
+namespace Nodens
+{
+
+BlockingPool::BlockingPool(unsigned int maxThreads, std::chrono::milliseconds idleTimeout, bool recordTimes)
+    : m_MaxThreads(std::max(1u, maxThreads)), m_IdleTimeout(idleTimeout), m_RecordTimes(recordTimes)
+{
+}
+
+BlockingPool::~BlockingPool()
+{
+    Shutdown();
+}
+
+void BlockingPool::Shutdown()
+{
+    // Jobs still running may push more while we join them: from here on Push() discards them and leaves the
+    // thread list alone, so it can be joined outside the lock.
+    std::vector<std::jthread> threads;
+    {
+        std::scoped_lock lock(m_Mutex);
+        m_ShuttingDown = true;
+        threads.swap(m_Threads);
+        for (std::jthread& thread : threads)
+            thread.request_stop();
+    }
+
+    // Wake everyone up and join. Threads stuck in a blocking job finish it first.
+    m_Condition.notify_all();
+    threads.clear();
+
+    // Release whatever never got to run, so the callables (and their captures) are destroyed. Taken out under the
+    // lock, discarded outside it, like in Push().
+    std::vector<Job*> leftover;
+    {
+        std::scoped_lock lock(m_Mutex);
+        for (JobQueue& queue : m_Queues)
+        {
+            while (!queue.Empty())
+                leftover.push_back(queue.PopFront());
+        }
+    }
+    for (Job* job : leftover)
+        job->Discard();
+}
+
+void BlockingPool::Push(std::span<Job* const> jobs, JobPriority priority)
+{
+    std::unique_lock lock(m_Mutex);
+    if (m_ShuttingDown)
+    {
+        // Nobody is left to run them. Discarded outside the lock, their captures may do anything on destruction.
+        lock.unlock();
+        for (Job* job : jobs)
+            job->Discard();
+        return;
+    }
+
+    for (Job* job : jobs)
+        m_Queues[static_cast<std::size_t>(priority)].PushBack(job);
+    m_Pending += jobs.size();
+    TracyPlot("Blocking Jobs Pending", static_cast<int64_t>(m_Pending));
+
+    // Every idle thread already has a job waiting for it: grow the pool instead of queueing behind a blocked one.
+    // Each new thread takes one of the jobs.
+    ReapExitedThreadsLocked();
+    std::size_t started = 0;
+    while (m_Pending > m_IdleThreads + started && m_Threads.size() < m_MaxThreads)
+    {
+        StartThreadLocked();
+        started++;
+    }
+
+    // The remaining jobs go to idle threads.
+    std::size_t wake = std::min<std::size_t>(jobs.size() - std::min(started, jobs.size()), m_IdleThreads);
+    if (wake == m_IdleThreads && wake > 0)
+    {
+        m_Condition.notify_all();
+    }
+    else
+    {
+        for (std::size_t i = 0; i < wake; ++i)
+            m_Condition.notify_one();
+    }
+}
+
+unsigned int BlockingPool::GetThreadCount()
+{
+    std::scoped_lock lock(m_Mutex);
+    return static_cast<unsigned int>(m_Threads.size() - m_ExitedThreads.size());
+}
+
+void BlockingPool::ThreadLoop(std::stop_token stoken)
+{
+    ScratchArena& scratch = ScratchArena::Get();
+
+    std::unique_lock lock(m_Mutex);
+    while (!stoken.stop_requested())
+    {
+        if (Job* job = PopLocked())
+        {
+            // Never hold the lock while the job blocks.
+            lock.unlock();
+            const int64_t start    = m_RecordTimes ? NowNanoseconds() : 0;
+            const int64_t waitTime = m_RecordTimes ? start - job->GetEnqueueTime() : -1;
+            {
+                ZoneScopedN("Blocking Job");
+                job->Run();
+            }
+            m_Counters.RecordJob(waitTime, m_RecordTimes ? NowNanoseconds() - start : -1, true);
+            scratch.Reset();
+            lock.lock();
+            continue;
+        }
+
+        m_IdleThreads++;
+        bool hasWork = m_Condition.wait_for(lock, stoken, m_IdleTimeout, [this] { return m_Pending > 0; });
+        m_IdleThreads--;
+
+        // Idle for too long: retire. The next Push() joins this thread.
+        if (!hasWork && !stoken.stop_requested())
+        {
+            m_ExitedThreads.push_back(std::this_thread::get_id());
+            TracyPlot("Blocking Threads", static_cast<int64_t>(m_Threads.size() - m_ExitedThreads.size()));
+            return;
+        }
+    }
+}
+
+Job* BlockingPool::PopLocked()
+{
+    for (JobQueue& queue : m_Queues)
+    {
+        if (!queue.Empty())
+        {
+            m_Pending--;
+            TracyPlot("Blocking Jobs Pending", static_cast<int64_t>(m_Pending));
+            return queue.PopFront();
+        }
+    }
+    return nullptr;
+}
+
+void BlockingPool::StartThreadLocked()
+{
+    m_Threads.emplace_back(
+        [this, number = m_NextThreadNumber++](std::stop_token stoken)
+        {
+            // Profiler hook: Give the thread a name so we can see it when
+            // using Tracy.
+            std::string name = "Blocking Worker " + std::to_string(number);
+            tracy::SetThreadName(name.c_str());
+
+            this->ThreadLoop(stoken);
+        });
+    TracyPlot("Blocking Threads", static_cast<int64_t>(m_Threads.size()));
+}
+
+void BlockingPool::ReapExitedThreadsLocked()
+{
+    // Retired threads have left ThreadLoop() and released the lock, so joining them here returns right away.
+    for (std::thread::id id : m_ExitedThreads)
+    {
+        auto it = std::find_if(m_Threads.begin(), m_Threads.end(),
+                               [id](const std::jthread& thread) { return thread.get_id() == id; });
+        if (it != m_Threads.end())
+        {
+            it->join();
+            m_Threads.erase(it);
+        }
+    }
+    m_ExitedThreads.clear();
+}
+
+} // namespace Nodens
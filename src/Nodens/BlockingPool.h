@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Nodens/Job.h"
+#include "Nodens/JobTelemetry.h"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include <tracy/Tracy.hpp>
+
+namespace Nodens
+{
+
+/// @brief An elastic pool of threads for jobs that block (sleeps, file or network I/O, waiting on external APIs).
+/// @details Unlike the compute workers, which are sized to the cores and must never be parked inside a job, this
+/// pool grows a thread whenever a job is queued and no idle thread can take it, up to a cap. Threads that stay
+/// idle for the idle timeout exit again, so the pool shrinks back once the burst is over. Jobs are served highest
+/// priority first. Owned by the JobSystem; submit to it with JobOptions::Pool = WorkerPool::Blocking.
+class BlockingPool
+{
+public:
+    /// @brief Creates an empty pool. No thread is started until the first job arrives.
+    /// @param maxThreads The maximum number of threads alive at once. Further jobs queue up.
+    /// @param idleTimeout How long a thread waits for work before it exits.
+    /// @param recordTimes Whether the wait and execution time of every job is measured (see GetStats()).
+    BlockingPool(unsigned int maxThreads, std::chrono::milliseconds idleTimeout, bool recordTimes = true);
+
+    /// @brief Shuts the pool down, see Shutdown().
+    ~BlockingPool();
+
+    /// @brief Stops and joins every thread. Jobs still queued, and jobs pushed from now on (e.g. by the blocking
+    /// jobs that are still finishing), are discarded without running. Safe to call more than once.
+    void Shutdown();
+
+    BlockingPool(const BlockingPool&)            = delete;
+    BlockingPool& operator=(const BlockingPool&) = delete;
+
+    /// @brief Queues jobs, waking idle threads or starting new ones, one thread per job.
+    void Push(std::span<Job* const> jobs, JobPriority priority);
+
+    /// @brief Gets the number of threads currently alive.
+    unsigned int GetThreadCount();
+
+    /// @brief Gets the maximum number of threads the pool may grow to.
+    inline unsigned int GetMaxThreadCount() const { return m_MaxThreads; }
+
+    /// @brief Reads the telemetry of all pool threads together. The idle time is not tracked.
+    inline WorkerStats GetStats() const { return m_Counters.Snapshot(); }
+
+private:
+    /// @brief The loop executed by every pool thread until it is stopped or retires.
+    void ThreadLoop(std::stop_token stoken);
+
+    /// @brief Pops the highest-priority queued job. Requires m_Mutex.
+    Job* PopLocked();
+
+    /// @brief Starts one more thread. Requires m_Mutex.
+    void StartThreadLocked();
+
+    /// @brief Joins threads that retired after their idle timeout. Requires m_Mutex.
+    void ReapExitedThreadsLocked();
+
+private:
+    const unsigned int              m_MaxThreads;
+    const std::chrono::milliseconds m_IdleTimeout;
+    const bool                      m_RecordTimes;
+
+    /// @brief Telemetry, shared by all pool threads.
+    JobCounters m_Counters{true};
+
+    /// @brief Queued jobs, one FIFO per priority.
+    std::array<JobQueue, kJobPriorityCount> m_Queues;
+    std::size_t                             m_Pending = 0;
+
+    /// @brief Threads waiting for work. A job is only handed to them while there are more of them than jobs.
+    unsigned int m_IdleThreads = 0;
+
+    /// @brief Set by the destructor: Push() discards jobs instead of queueing them.
+    bool m_ShuttingDown = false;
+
+    /// @brief Used to give every thread a distinct name in Tracy.
+    unsigned int m_NextThreadNumber = 0;
+
+    /// @brief Mutex to protect the queues, the counters and the thread list.
+    TracyLockable(std::mutex, m_Mutex);
+
+    /// @note std::condition_variable_any is required to work with std::stop_token.
+    std::condition_variable_any m_Condition;
+
+    /// @brief Threads that retired and are waiting to be joined.
+    std::vector<std::thread::id> m_ExitedThreads;
+
+    /// @warning Declared last so the threads are joined before anything they use is destroyed.
+    std::vector<std::jthread> m_Threads;
+};
+
+} // namespace Nodens
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
 #include <memory>
 
 #ifdef _WIN32
@@ -32,6 +33,12 @@ template <std::integral T = int> consteval T Bit(T x)
     return T(1) << x;
 }
 
+/// @brief Size of a cache line on the supported targets.
+/// @details Used to align data written by different threads so they don't false-share.
+/// std::hardware_destructive_interference_size is avoided on purpose, as its value may differ between
+/// compiler versions and break the ABI.
+inline constexpr std::size_t kCacheLineSize = 64;
+
 } // namespace Nodens
 
 #ifdef ND_ENABLE_ASSERTS
@@ -0,0 +1,238 @@
+#include "CpuTopology.h"
+
+#include "ndpch.h"
+
+#include <algorithm>
+#include <map>
+#include <thread>
+
+#if defined(__linux__)
+    #include <filesystem>
+    #include <fstream>
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace Nodens
+{
+
+#if defined(__linux__)
+
+// Reads a single value from a sysfs file. Returns false if the file is missing (e.g. no such cache level).
+template <class T> static bool ReadSysValue(const std::filesystem::path& path, T& value)
+{
+    std::ifstream file(path);
+    return static_cast<bool>(file >> value);
+}
+
+static bool DetectPlatformTopology(std::vector<LogicalCpu>& cpus)
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+        return false;
+
+    const std::filesystem::path root = "/sys/devices/system/cpu";
+
+    // Dense ids for cores (package + core id) and last-level caches (their shared CPU list).
+    std::map<uint64_t, unsigned int>    cores;
+    std::map<std::string, unsigned int> domains;
+
+    for (unsigned int id = 0; id < CPU_SETSIZE; ++id)
+    {
+        if (!CPU_ISSET(id, &allowed))
+            continue;
+
+        const std::filesystem::path cpuPath = root / ("cpu" + std::to_string(id));
+
+        unsigned int package = 0, coreId = id;
+        ReadSysValue(cpuPath / "topology" / "physical_package_id", package);
+        ReadSysValue(cpuPath / "topology" / "core_id", coreId);
+
+        // Find the L3 among the cache indices. Without one, the package is the cache domain.
+        std::string domainKey = "package" + std::to_string(package);
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(cpuPath / "cache", error))
+        {
+            unsigned int level = 0;
+            std::string  sharedCpus;
+            if (ReadSysValue(entry.path() / "level", level) && level == 3 &&
+                ReadSysValue(entry.path() / "shared_cpu_list", sharedCpus))
+            {
+                domainKey = sharedCpus;
+                break;
+            }
+        }
+
+        LogicalCpu cpu;
+        cpu.Id          = id;
+        cpu.Core        = cores.try_emplace((uint64_t(package) << 32) | coreId, unsigned(cores.size())).first->second;
+        cpu.CacheDomain = domains.try_emplace(domainKey, unsigned(domains.size())).first->second;
+        cpus.push_back(cpu);
+    }
+    return !cpus.empty();
+}
+
+bool PinCurrentThread(std::span<const unsigned int> cpus)
+{
+    if (cpus.empty())
+        return true;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned int cpu : cpus)
+    {
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+#elif defined(ND_PLATFORM_WINDOWS)
+
+// Only processor group 0 (the first 64 logical CPUs) is handled, matching SetThreadAffinityMask().
+static bool DetectPlatformTopology(std::vector<LogicalCpu>& cpus)
+{
+    DWORD_PTR processMask = 0, systemMask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+        return false;
+
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+    std::vector<std::byte> buffer(length);
+    auto* first = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data());
+    if (length == 0 || !GetLogicalProcessorInformationEx(RelationAll, first, &length))
+        return false;
+
+    constexpr unsigned int kMaxCpus = 64;
+    unsigned int           coreOf[kMaxCpus];
+    unsigned int           domainOf[kMaxCpus];
+    std::fill(std::begin(coreOf), std::end(coreOf), ~0u);
+    std::fill(std::begin(domainOf), std::end(domainOf), 0u);
+
+    unsigned int coreCount = 0, domainCount = 0;
+    for (DWORD offset = 0; offset < length;)
+    {
+        auto* info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+        if (info->Relationship == RelationProcessorCore && info->Processor.GroupMask[0].Group == 0)
+        {
+            const KAFFINITY mask = info->Processor.GroupMask[0].Mask;
+            for (unsigned int id = 0; id < kMaxCpus; ++id)
+            {
+                if (mask & (KAFFINITY(1) << id))
+                    coreOf[id] = coreCount;
+            }
+            coreCount++;
+        }
+        else if (info->Relationship == RelationCache && info->Cache.Level == 3 && info->Cache.GroupMask.Group == 0)
+        {
+            const KAFFINITY mask = info->Cache.GroupMask.Mask;
+            for (unsigned int id = 0; id < kMaxCpus; ++id)
+            {
+                if (mask & (KAFFINITY(1) << id))
+                    domainOf[id] = domainCount;
+            }
+            domainCount++;
+        }
+        offset += info->Size;
+    }
+
+    for (unsigned int id = 0; id < kMaxCpus; ++id)
+    {
+        if ((processMask & (DWORD_PTR(1) << id)) && coreOf[id] != ~0u)
+            cpus.push_back({id, coreOf[id], domainOf[id]});
+    }
+    return !cpus.empty();
+}
+
+bool PinCurrentThread(std::span<const unsigned int> cpus)
+{
+    if (cpus.empty())
+        return true;
+
+    DWORD_PTR mask = 0;
+    for (unsigned int cpu : cpus)
+    {
+        if (cpu < 64)
+            mask |= DWORD_PTR(1) << cpu;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+}
+
+#else
+
+static bool DetectPlatformTopology(std::vector<LogicalCpu>&)
+{
+    return false;
+}
+
+bool PinCurrentThread(std::span<const unsigned int> cpus)
+{
+    return cpus.empty();
+}
+
+#endif
+
+CpuTopology CpuTopology::Detect()
+{
+    ZoneScoped;
+
+    CpuTopology topology;
+    if (!DetectPlatformTopology(topology.Cpus))
+    {
+        // Unknown layout: treat every hardware thread as a core of its own.
+        ND_CORE_WARN("CPU topology could not be detected, assuming a flat layout.");
+        topology.Cpus.clear();
+        unsigned int count = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int id = 0; id < count; ++id)
+            topology.Cpus.push_back({id, id, 0});
+    }
+
+    std::sort(topology.Cpus.begin(), topology.Cpus.end(),
+              [](const LogicalCpu& a, const LogicalCpu& b)
+              {
+                  if (a.CacheDomain != b.CacheDomain)
+                      return a.CacheDomain < b.CacheDomain;
+                  if (a.Core != b.Core)
+                      return a.Core < b.Core;
+                  return a.Id < b.Id;
+              });
+
+    for (const LogicalCpu& cpu : topology.Cpus)
+    {
+        topology.PhysicalCoreCount = std::max(topology.PhysicalCoreCount, cpu.Core + 1);
+        topology.CacheDomainCount  = std::max(topology.CacheDomainCount, cpu.CacheDomain + 1);
+    }
+    return topology;
+}
+
+std::string CpuTopology::Describe() const
+{
+    return std::to_string(Cpus.size()) + " logical CPUs, " + std::to_string(PhysicalCoreCount) + " physical cores, " +
+           std::to_string(CacheDomainCount) + " L3 domains";
+}
+
+std::string FormatCpuList(std::span<const unsigned int> cpus)
+{
+    std::vector<unsigned int> sorted(cpus.begin(), cpus.end());
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+    std::string result;
+    for (std::size_t i = 0; i < sorted.size();)
+    {
+        std::size_t last = i;
+        while (last + 1 < sorted.size() && sorted[last + 1] == sorted[last] + 1)
+            last++;
+
+        if (!result.empty())
+            result += ',';
+        result += std::to_string(sorted[i]);
+        if (last > i)
+            result += '-' + std::to_string(sorted[last]);
+        i = last + 1;
+    }
+    return result;
+}
+
+} // namespace Nodens
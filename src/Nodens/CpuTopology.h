@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Nodens
+{
+
+/// @brief One logical CPU (hardware thread) the process may run on.
+struct LogicalCpu
+{
+    /// @brief The OS index of the CPU, as used by affinity masks.
+    unsigned int Id = 0;
+
+    /// @brief Identifies the physical core. SMT siblings share it; unique across packages.
+    unsigned int Core = 0;
+
+    /// @brief Identifies the last-level cache (L3) the CPU belongs to. CPUs sharing it exchange data cheaply.
+    unsigned int CacheDomain = 0;
+};
+
+/// @brief The CPUs available to the process, grouped by physical core and last-level cache.
+/// @details Read from /sys/devices/system/cpu on Linux and from GetLogicalProcessorInformationEx() on Windows.
+/// Elsewhere, or if detection fails, every logical CPU is reported as its own core in a single cache domain.
+struct CpuTopology
+{
+    /// @brief Usable logical CPUs (online and in the process affinity mask), sorted by cache domain, then core.
+    std::vector<LogicalCpu> Cpus;
+
+    unsigned int PhysicalCoreCount = 0;
+    unsigned int CacheDomainCount  = 0;
+
+    /// @brief Detects the topology of the machine.
+    static CpuTopology Detect();
+
+    /// @brief Gets a one-line summary for the log, e.g. "16 logical CPUs, 8 physical cores, 2 L3 domains".
+    std::string Describe() const;
+};
+
+/// @brief Restricts the calling thread to the given logical CPUs.
+/// @param cpus The OS indices of the allowed CPUs. Ignored if empty.
+/// @return False if the platform refused the request or does not support affinity.
+bool PinCurrentThread(std::span<const unsigned int> cpus);
+
+/// @brief Formats a CPU list compactly for the log, e.g. "0-3,8,10".
+std::string FormatCpuList(std::span<const unsigned int> cpus);
+
+} // namespace Nodens
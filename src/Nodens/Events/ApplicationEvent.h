@@ -21,6 +21,9 @@ public:
     /// @brief The categories this event belongs to.
     static constexpr int Category = EventCategoryApplication;
 
+    /// @brief Only the final size of a drag matters, see ConflationPolicy.
+    static constexpr ConflationPolicy Conflation = ConflationPolicy::LatestWins;
+
     /// @brief Constructs a resize event.
     /// @param width The new width of the window.
     /// @param height The new height of the window.
@@ -4,50 +4,459 @@
 #include "ndpch.h"
 #include <tracy/Tracy.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <ranges>
+
 namespace Nodens
 {
 
+// ==================================================================
+// BOUNDED QUEUE
+// Pending events wait in a ring allocated up front, and every accepted
+// event gets one job. The jobs are tickets rather than owners: each one
+// dispatches whichever event is oldest when it runs, so dropping the
+// oldest event is a pop instead of a search through the job queues.
+// There are never fewer tickets than pending events; surplus ones (the
+// event was dispatched by a blocked publisher) find the ring empty.
+// ==================================================================
+class AsyncEventBus::BoundedQueue
+{
+public:
+    explicit BoundedQueue(const EventQueueConfig& config) : m_Config(config), m_Ring(config.Capacity) {}
+
+    void SetConfig(const EventQueueConfig& config)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        // Keep the pending events in order; a smaller capacity only refuses new ones until the backlog is gone.
+        std::vector<Item> ring(std::max(config.Capacity, m_Count));
+        for (std::size_t i = 0; i < m_Count; ++i)
+            ring[i] = std::move(m_Ring[(m_Head + i) % m_Ring.size()]);
+
+        m_Ring.swap(ring);
+        m_Head   = 0;
+        m_Config = config;
+        m_Room.notify_all();
+    }
+
+    void Push(PooledEvent event, EventHandler onComplete)
+    {
+        // Dropped events are destroyed once the lock is released: their destructors are user code.
+        Item       dropped;
+        JobOptions options;
+        {
+            std::unique_lock lock(m_Mutex);
+            if (m_Count >= m_Config.Capacity)
+            {
+                switch (m_Config.Policy)
+                {
+                case OverflowPolicy::Block:
+                    m_Stats.Blocked++;
+                    WaitForRoom(lock);
+                    break;
+                case OverflowPolicy::DropNewest:
+                    m_Stats.Dropped++;
+                    return;
+                case OverflowPolicy::Sample:
+                    if (++m_Overflows % std::max<uint32_t>(m_Config.SampleRate, 1) != 0)
+                    {
+                        m_Stats.Dropped++;
+                        return;
+                    }
+                    [[fallthrough]];
+                case OverflowPolicy::DropOldest:
+                    // The new event takes over the ticket of the one it replaces.
+                    dropped = Pop();
+                    m_Stats.Dropped++;
+                    Add({std::move(event), std::move(onComplete)});
+                    return;
+                }
+            }
+
+            Add({std::move(event), std::move(onComplete)});
+            options = m_Config.Options;
+        }
+        GetJobSystem().SubmitDetached(options, Ticket(this, options));
+    }
+
+    EventQueueStats GetStats()
+    {
+        std::scoped_lock lock(m_Mutex);
+        EventQueueStats  stats = m_Stats;
+        stats.Pending          = m_Count;
+        return stats;
+    }
+
+private:
+    struct Item
+    {
+        PooledEvent  Event;
+        EventHandler OnComplete;
+    };
+
+    // A job's claim on one pending event: dispatches the oldest when run, drops it if the job is cancelled, so a
+    // cancelled job does not leave an event behind that no ticket will ever take.
+    class Ticket
+    {
+    public:
+        Ticket(BoundedQueue* queue, const JobOptions& options) : m_Queue(queue), m_Options(options) {}
+        Ticket(Ticket&& other) noexcept
+            : m_Queue(std::exchange(other.m_Queue, nullptr)), m_Options(std::move(other.m_Options))
+        {
+        }
+        Ticket& operator=(Ticket&&) = delete;
+
+        ~Ticket()
+        {
+            if (m_Queue)
+                m_Queue->TakeOldest();
+        }
+
+        void operator()()
+        {
+            Item item = std::exchange(m_Queue, nullptr)->TakeOldest();
+            if (item.Event)
+                AsyncEventBus::Get().Dispatch(std::move(item.Event), std::move(item.OnComplete), m_Options);
+        }
+
+    private:
+        BoundedQueue* m_Queue;
+        JobOptions    m_Options;
+    };
+
+    // Takes the oldest pending event, or an empty item if there is none.
+    Item TakeOldest()
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Count > 0 ? Pop() : Item{};
+    }
+
+    // Holds a publisher back until there is room. Called with the mutex held.
+    void WaitForRoom(std::unique_lock<std::mutex>& lock)
+    {
+        // A compute worker waiting for the other workers could wait forever once they all do, so it works off the
+        // backlog itself. Other threads (the main thread, blocking-pool threads) just wait.
+        if (GetJobSystem().GetCurrentWorkerIndex() < 0)
+        {
+            m_Room.wait(lock, [this]() { return m_Count < m_Config.Capacity; });
+            return;
+        }
+
+        while (m_Count >= m_Config.Capacity)
+        {
+            Item       oldest  = Pop();
+            JobOptions options = m_Config.Options;
+            lock.unlock();
+            AsyncEventBus::Get().Dispatch(std::move(oldest.Event), std::move(oldest.OnComplete), options);
+            lock.lock();
+        }
+    }
+
+    // Appends to the ring. Called with the mutex held, and room in the ring.
+    void Add(Item item)
+    {
+        m_Ring[(m_Head + m_Count) % m_Ring.size()] = std::move(item);
+        m_Count++;
+        m_Stats.Accepted++;
+        m_Stats.PeakPending = std::max(m_Stats.PeakPending, m_Count);
+    }
+
+    // Removes the oldest item from the ring and wakes a blocked publisher. Called with the mutex held.
+    Item Pop()
+    {
+        Item item = std::move(m_Ring[m_Head]);
+        m_Head    = (m_Head + 1) % m_Ring.size();
+        m_Count--;
+        m_Room.notify_one();
+        return item;
+    }
+
+private:
+    std::mutex              m_Mutex;
+    std::condition_variable m_Room;
+    EventQueueConfig        m_Config;
+
+    // The pending events, oldest first from m_Head.
+    std::vector<Item> m_Ring;
+    std::size_t       m_Head  = 0;
+    std::size_t       m_Count = 0;
+
+    // Events published into a full queue, to pick every SampleRate-th one.
+    uint32_t        m_Overflows = 0;
+    EventQueueStats m_Stats;
+};
+
 AsyncEventBus& AsyncEventBus::Get()
 {
     static AsyncEventBus instance;
     return instance;
 }
 
-void AsyncEventBus::SubscribeInternal(std::type_index type, EventHandler handler)
+JobSystem& AsyncEventBus::GetJobSystem()
+{
+    return Application::Get().GetJobSystem();
+}
+
+MainThreadExecutor& AsyncEventBus::GetMainThreadExecutor()
+{
+    return Application::Get().GetMainThreadExecutor();
+}
+
+void AsyncEventBus::UpdateEntry(EventTypeId type, const std::function<void(TypeEntry&)>& update)
 {
-    // Lock just long enough to add the handler to the list
+    // Changes are rare, so they pay for the copies: a new table, and a new entry for this type only.
     std::scoped_lock lock(m_Mutex);
-    m_Subscribers[type].push_back(handler);
+
+    std::shared_ptr<const SubscriberTable> current = m_Subscribers.load(std::memory_order_relaxed);
+    auto next = current ? std::make_shared<SubscriberTable>(*current) : std::make_shared<SubscriberTable>();
+    if (next->size() <= type)
+    {
+        // Room for every type known so far, so the table rarely grows again.
+        next->resize(std::max<std::size_t>(type + 1, GetEventTypeCount()));
+    }
+
+    std::shared_ptr<const TypeEntry>& slot  = (*next)[type];
+    auto                              entry = slot ? std::make_shared<TypeEntry>(*slot) : std::make_shared<TypeEntry>();
+    update(*entry);
+    slot = std::move(entry);
+
+    // Dispatches already running keep the snapshot they loaded; later ones see the change.
+    m_Subscribers.store(std::move(next), std::memory_order_release);
+}
+
+std::shared_ptr<const AsyncEventBus::TypeEntry> AsyncEventBus::FindEntry(EventTypeId type) const
+{
+    // Looking the entry up is a bounds check and an array index.
+    std::shared_ptr<const SubscriberTable> subscribers = m_Subscribers.load(std::memory_order_acquire);
+    if (!subscribers || type >= subscribers->size())
+    {
+        return nullptr;
+    }
+    return (*subscribers)[type];
+}
+
+void AsyncEventBus::SubscribeInternal(EventTypeId type, EventHandler handler, const SubscribeOptions& options)
+{
+    UpdateEntry(type,
+                [&](TypeEntry& entry)
+                {
+                    if (options.Independent)
+                        entry.IndependentHandlers.push_back(std::move(handler));
+                    else
+                        entry.Handlers.push_back(std::move(handler));
+                });
+}
+
+void AsyncEventBus::SubscribeBatchInternal(EventTypeId type, BatchHandler handler)
+{
+    UpdateEntry(type, [&handler](TypeEntry& entry) { entry.BatchHandlers.push_back(std::move(handler)); });
+}
+
+void AsyncEventBus::SubscribeOrderedInternal(EventTypeId type, OrderedHandler handler)
+{
+    UpdateEntry(type, [&handler](TypeEntry& entry) { entry.OrderedHandlers.push_back(std::move(handler)); });
 }
 
-void AsyncEventBus::PublishInternal(std::shared_ptr<Event> event)
+void AsyncEventBus::EnableBatchingInternal(EventTypeId type, const EventBatchConfig& config,
+                                           std::shared_ptr<BatchBase> (*create)(const EventBatchConfig&))
+{
+    ND_CORE_ASSERT(config.MaxEvents > 0 || config.FlushEveryFrame, "A batch must be flushed by size or per frame!");
+
+    UpdateEntry(type,
+                [&](TypeEntry& entry)
+                {
+                    ND_CORE_ASSERT(!entry.Queue, "A type is either batched or limited, not both!");
+
+                    // The batch is kept once created: publishers may still hold a pointer to it.
+                    if (entry.Batch)
+                        entry.Batch->SetConfig(config);
+                    else
+                        entry.Batch = create(config);
+                });
+}
+
+void AsyncEventBus::LimitQueueInternal(EventTypeId type, const EventQueueConfig& config)
+{
+    ND_CORE_ASSERT(config.Capacity > 0, "A queue needs room for at least one event!");
+
+    UpdateEntry(type,
+                [&](TypeEntry& entry)
+                {
+                    ND_CORE_ASSERT(!entry.Batch, "A type is either batched or limited, not both!");
+
+                    // Like a batch, the queue is kept once created: jobs hold tickets to it.
+                    if (entry.Queue)
+                        entry.Queue->SetConfig(config);
+                    else
+                        entry.Queue = std::make_shared<BoundedQueue>(config);
+                });
+}
+
+EventQueueStats AsyncEventBus::GetQueueStatsInternal(EventTypeId type) const
+{
+    std::shared_ptr<const TypeEntry> entry = FindEntry(type);
+    return entry && entry->Queue ? entry->Queue->GetStats() : EventQueueStats{};
+}
+
+void AsyncEventBus::Flush()
+{
+    ZoneScoped;
+
+    if (std::shared_ptr<const SubscriberTable> subscribers = m_Subscribers.load(std::memory_order_acquire))
+    {
+        for (const std::shared_ptr<const TypeEntry>& entry : *subscribers)
+        {
+            if (entry && entry->Batch)
+                entry->Batch->Flush(false);
+        }
+    }
+}
+
+void AsyncEventBus::EndFrame()
+{
+    ZoneScoped;
+
+    if (std::shared_ptr<const SubscriberTable> subscribers = m_Subscribers.load(std::memory_order_acquire))
+    {
+        for (const std::shared_ptr<const TypeEntry>& entry : *subscribers)
+        {
+            if (entry && entry->Batch)
+                entry->Batch->Flush(true);
+        }
+    }
+}
+
+void AsyncEventBus::PublishInternal(const TypeEntry* entry, PooledEvent event, const JobOptions& options,
+                                    EventHandler onComplete)
 {
     // Profile the act of submitting (usually fast)
     ZoneScoped;
 
-    Application::Get().GetJobSystem().Submit(
-        [this, event]()
+    // Limited types go through their queue, which submits the job once it accepts the event.
+    if (entry && entry->Queue)
+    {
+        entry->Queue->Push(std::move(event), std::move(onComplete));
+        return;
+    }
+
+    // The job owns the event: it goes back to its pool when the job is done, or dropped by a cancellation.
+    auto job = [this, event = std::move(event), onComplete = std::move(onComplete), options]() mutable
+    {
+        Dispatch(std::move(event), std::move(onComplete), options);
+    };
+    GetJobSystem().SubmitDetached(options, std::move(job));
+}
+
+void AsyncEventBus::PublishBatchInternal(const TypeEntry* entry, std::span<PooledEvent> events,
+                                         const JobOptions& options)
+{
+    ZoneScoped;
+
+    // The queue applies its policy event by event.
+    if (entry && entry->Queue)
+    {
+        for (PooledEvent& event : events)
+            entry->Queue->Push(std::move(event), {});
+        return;
+    }
+
+    // The returned group is not needed: like Publish(), the batch is fire and forget.
+    GetJobSystem().SubmitBatch(
+        options, events | std::views::transform(
+                              [this, &options](PooledEvent& event)
+                              {
+                                  return [this, event = std::move(event), options]() mutable
+                                  { Dispatch(std::move(event), {}, options); };
+                              }));
+}
+
+struct AsyncEventBus::FanOutState
+{
+    std::shared_ptr<const TypeEntry> Entry;
+    PooledEvent                      Payload;
+    EventHandler                     OnComplete;
+
+    // The jobs still running handlers, the one that fans out included.
+    std::atomic<std::size_t> Remaining;
+
+    // Signalled by the batch in place of a heap-allocated JobGroup. Nothing waits on it: Remaining completes the event.
+    JobCounter Jobs;
+
+    // Called by every job once its handlers are done: the last one completes the event.
+    void Done()
+    {
+        if (Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1 && OnComplete)
         {
-            // Profile the asynchronous execution (the actual work)
-            ZoneScoped;
-            const char* name = event->GetName();
-            ZoneName(name, strlen(name));
+            OnComplete(*Payload);
+        }
+    }
+};
 
-            std::vector<EventHandler> handlers;
-            {
-                std::scoped_lock lock(m_Mutex);
-                auto             it = m_Subscribers.find(typeid(*event));
-                if (it != m_Subscribers.end())
-                {
-                    handlers = it->second;
-                }
-            }
+void AsyncEventBus::Dispatch(PooledEvent event, EventHandler onComplete, const JobOptions& options)
+{
+    // Profile the asynchronous execution (the actual work)
+    ZoneScoped;
+    const char* name = event->GetName();
+    ZoneName(name, strlen(name));
 
-            for (auto& handler : handlers)
-            {
-                handler(*event);
-            }
-        });
+    // The entry is immutable, so the handlers run straight from it, even if others subscribe meanwhile.
+    std::shared_ptr<const TypeEntry> entry = FindEntry(event->GetTypeId());
+    if (entry && !entry->IndependentHandlers.empty())
+    {
+        FanOut(std::move(entry), std::move(event), std::move(onComplete), options);
+        return;
+    }
+
+    if (entry)
+    {
+        RunHandlers(*entry, *event);
+    }
+
+    if (onComplete)
+    {
+        onComplete(*event);
+    }
+}
+
+void AsyncEventBus::FanOut(std::shared_ptr<const TypeEntry> entry, PooledEvent event, EventHandler onComplete,
+                           const JobOptions& options)
+{
+    // The jobs share the event: whichever finishes last releases it, after 'onComplete'. A cancelled job drops its
+    // share without calling Done(), so the event is still released but never completed.
+    const std::size_t count = entry->IndependentHandlers.size();
+    auto              state = std::make_shared<FanOutState>(std::move(entry), std::move(event), std::move(onComplete),
+                                                            count + 1);
+
+    GetJobSystem().SubmitBatch(options, state->Jobs, std::views::iota(std::size_t{0}, count) |
+                                            std::views::transform(
+                                                [&state](std::size_t i)
+                                                {
+                                                    return [state, i]()
+                                                    {
+                                                        ZoneScopedN("Independent Handler");
+                                                        state->Entry->IndependentHandlers[i](*state->Payload);
+                                                        state->Done();
+                                                    };
+                                                }));
+
+    // Meanwhile the ordered handlers run here, so this job is not idle while the others work.
+    RunHandlers(*state->Entry, *state->Payload);
+    state->Done();
+}
+
+void AsyncEventBus::RunHandlers(const TypeEntry& entry, Event& event)
+{
+    for (const EventHandler& handler : entry.Handlers)
+    {
+        handler(event);
+    }
+
+    // Batch handlers of an unbatched type get batches of one.
+    for (const BatchHandler& handler : entry.BatchHandlers)
+    {
+        handler(event, 1);
+    }
 }
 
 } // namespace Nodens
\ No newline at end of file
@@ -1,16 +1,98 @@
 #pragma once
 
 #include "Nodens/Events/Event.h"
+#include "Nodens/Events/PooledEvent.h"
+#include "Nodens/JobSystem.h"
+#include "Nodens/MainThreadExecutor.h"
+#include "Nodens/Strand.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <typeindex>
-#include <unordered_map>
+#include <span>
 #include <vector>
 
+#include <tracy/Tracy.hpp>
+
 namespace Nodens
 {
 
+/// @brief How AsyncEventBus collects the events of one type into batches, see AsyncEventBus::EnableBatching().
+struct EventBatchConfig
+{
+    /// @brief Dispatch once this many events are pending. 0 for no limit.
+    std::size_t MaxEvents = 256;
+
+    /// @brief Dispatch whatever is pending at the end of every frame (see AsyncEventBus::EndFrame()).
+    bool FlushEveryFrame = true;
+
+    /// @brief The options batches are dispatched with. Options passed to Publish() do not apply to batched types.
+    JobOptions Options;
+};
+
+/// @brief What AsyncEventBus does with an event published while the queue of its type is full.
+enum class OverflowPolicy : uint8_t
+{
+    /// @brief The publisher waits until there is room. On a compute worker, where waiting could deadlock the pool, it
+    /// dispatches the oldest pending events itself instead.
+    Block,
+
+    /// @brief The oldest pending event is dropped to make room. For state where only recent events matter.
+    DropOldest,
+
+    /// @brief The new event is dropped. For work where the events already queued must all be handled.
+    DropNewest,
+
+    /// @brief One event in EventQueueConfig::SampleRate replaces the oldest pending one, the others are dropped. Keeps
+    /// a thinned-out but steady stream of fresh events flowing under overload.
+    Sample,
+};
+
+/// @brief How many events of one type AsyncEventBus lets wait for a worker, see AsyncEventBus::LimitQueue().
+struct EventQueueConfig
+{
+    /// @brief The most events of the type waiting to be dispatched at any time.
+    std::size_t Capacity = 1024;
+
+    /// @brief What to do with an event published while the queue is full.
+    OverflowPolicy Policy = OverflowPolicy::Block;
+
+    /// @brief With OverflowPolicy::Sample, one of this many events published while the queue is full is kept.
+    uint32_t SampleRate = 8;
+
+    /// @brief The options the events are dispatched with. Options passed to Publish() do not apply to limited types.
+    JobOptions Options;
+};
+
+/// @brief Counters of the queue of one event type, see AsyncEventBus::GetQueueStats(). All grow from LimitQueue().
+struct EventQueueStats
+{
+    /// @brief Events accepted into the queue.
+    uint64_t Accepted = 0;
+
+    /// @brief Events dropped by the overflow policy, new or pending.
+    uint64_t Dropped = 0;
+
+    /// @brief Publishes that found the queue full and were held back (OverflowPolicy::Block).
+    uint64_t Blocked = 0;
+
+    /// @brief Events waiting to be dispatched right now.
+    std::size_t Pending = 0;
+
+    /// @brief The most events that were ever waiting at once.
+    std::size_t PeakPending = 0;
+};
+
+/// @brief How a handler subscribed to AsyncEventBus runs, see AsyncEventBus::Subscribe().
+struct SubscribeOptions
+{
+    /// @brief Run the handler in a job of its own, in parallel with the other handlers of the same event, instead of
+    /// one after another with them. For slow handlers that neither depend on the others nor modify the event.
+    bool Independent = false;
+};
+
 class AsyncEventBus
 {
 public:
@@ -23,48 +105,540 @@ public:
     // ==================================================================
     // 1. SUBSCRIBE
     // Systems call this to listen for specific events (e.g., "CollisionEvent")
+    // Handlers of an event run one after another, in subscription order,
+    // except those marked options.Independent: each of them is fanned out
+    // to a job of its own, so one slow handler does not hold up the rest
+    // and a heavy event can use several workers.
+    // Since every event is dispatched by a job of its own, two events of
+    // a type may reach a handler out of order, or at the same time; see
+    // SubscribeOrdered() and SubscribeMainThread() for handlers that must
+    // not.
     // ==================================================================
-    template <typename T> void Subscribe(const std::function<void(T&)>& handler)
+    template <IsEvent T> void Subscribe(const std::function<void(T&)>& handler, const SubscribeOptions& options = {})
     {
         // We wrap the specific handler (T&) into a generic one (Event&)
         // This allows us to store all handlers in a single generic list.
         auto wrapper = [handler](Event& e)
         {
-            // Safe cast because we map this wrapper to typeid(T) below
+            // Safe cast because we map this wrapper to the type ID of T below
             handler(static_cast<T&>(e));
         };
 
-        SubscribeInternal(typeid(T), wrapper);
+        SubscribeInternal(T::GetStaticTypeId(), wrapper, options);
+    }
+
+    // Same as Subscribe(), but the handler runs on a Strand: it receives
+    // the events one at a time, in the order they were published, so the
+    // state it touches needs no mutex. Without 'strand' the subscription
+    // gets a strand of its own; pass one to serialize it with others,
+    // e.g. handlers of several event types updating the same state.
+    // The handler gets a copy of the event, taken when it is published,
+    // so the event type must be copyable.
+    template <IsEvent T>
+        requires std::copy_constructible<T>
+    void SubscribeOrdered(const std::function<void(T&)>& handler, std::shared_ptr<Strand> strand = nullptr)
+    {
+        if (!strand)
+            strand = std::make_shared<Strand>(GetJobSystem());
+
+        // Queued by the publisher, so the handler sees the events in publish order. The published event is released
+        // once the workers are done with it, so the queued work takes a copy.
+        auto shared = std::make_shared<const std::function<void(T&)>>(handler);
+        SubscribeOrderedInternal(T::GetStaticTypeId(),
+                                 [shared, strand = std::move(strand)](const Event& e)
+                                 {
+                                     strand->Post([shared, event = static_cast<const T&>(e)]() mutable
+                                                  { (*shared)(event); });
+                                 });
+    }
+
+    // Same as SubscribeOrdered(), but the handler runs on the main thread,
+    // through the MainThreadExecutor of the application, so it may touch
+    // main-thread state (UI, layers) without locking. It runs within the
+    // per-frame budget of the executor, so it may be a few frames late
+    // under load.
+    template <IsEvent T>
+        requires std::copy_constructible<T>
+    void SubscribeMainThread(const std::function<void(T&)>& handler)
+    {
+        auto shared = std::make_shared<const std::function<void(T&)>>(handler);
+        SubscribeOrderedInternal(T::GetStaticTypeId(),
+                                 [shared](const Event& e)
+                                 {
+                                     GetMainThreadExecutor().Post([shared, event = static_cast<const T&>(e)]() mutable
+                                                                  { (*shared)(event); });
+                                 });
     }
 
     // ==================================================================
-    // 2. PUBLISH (Fire and Forget)
+    // 2. SUBSCRIBE TO BATCHES
+    // Same as Subscribe(), for handlers that process many events at once.
+    // For a batched type (see EnableBatching()) the handler receives each
+    // batch as one contiguous span; otherwise spans of a single event.
+    // ==================================================================
+    template <IsEvent T> void SubscribeBatch(const std::function<void(std::span<T>)>& handler)
+    {
+        auto wrapper = [handler](Event& first, std::size_t count)
+        {
+            // Safe cast: 'first' is the first of 'count' contiguous events of type T
+            handler(std::span<T>(&static_cast<T&>(first), count));
+        };
+
+        SubscribeBatchInternal(T::GetStaticTypeId(), wrapper);
+    }
+
+    // ==================================================================
+    // 3. PUBLISH (Fire and Forget)
     // Systems call this to broadcast an event. It returns IMMEDIATELY.
     // The actual processing happens later on a background thread.
+    // 'options' selects the job priority the handlers run with, e.g.
+    // JobPriority::Background for bulk work that must not delay the frame.
     // ==================================================================
-    template <typename T> void Publish(T event)
+    template <IsEvent T> void Publish(T event, const JobOptions& options = {})
     {
-        // CRITICAL: We must COPY the event into a smart pointer.
+        std::shared_ptr<const TypeEntry> entry = FindEntry(T::GetStaticTypeId());
+        PostOrdered(entry.get(), event);
+
+        // Batched types collect the event instead of dispatching it on its own.
+        if (Batch<T>* batch = FindBatch<T>(entry.get()))
+        {
+            batch->Add(std::move(event));
+            return;
+        }
+
+
+        // CRITICAL: We must MOVE the event into storage of its own.
         // The original 'event' variable on the stack will be destroyed
         // immediately after this function returns, but the thread needs
-        // to access it milliseconds later.
-        auto eventPtr = std::make_shared<T>(event);
+        // to access it milliseconds later. The storage comes from a pool
+        // and is recycled once the handlers are done (see PooledEvent).
+        PublishInternal(entry.get(), PooledEvent::Create<T>(std::move(event)), options);
+    }
 
-        PublishInternal(eventPtr);
+    // Same as Publish(), and calls 'onComplete' with the event once all of
+    // its handlers are done, independent ones included, on the worker that
+    // finished last. Such an event is dispatched on its own, even if its
+    // type is batched. If a job of it is cancelled, 'onComplete' is not
+    // called. Ordered and main-thread handlers work on copies of their
+    // own and are not waited for.
+    template <IsEvent T, std::invocable<T&> F> void Publish(T event, const JobOptions& options, F&& onComplete)
+    {
+        auto wrapper = [onComplete = std::forward<F>(onComplete)](Event& e) mutable
+        {
+            onComplete(static_cast<T&>(e));
+        };
+
+        std::shared_ptr<const TypeEntry> entry = FindEntry(T::GetStaticTypeId());
+        PostOrdered(entry.get(), event);
+        PublishInternal(entry.get(), PooledEvent::Create<T>(std::move(event)), options, std::move(wrapper));
+    }
+
+    // ==================================================================
+    // 4. EMPLACE (Fire and Forget)
+    // Same as Publish(), but constructs the event from 'args' directly
+    // in its pooled storage, without a temporary to copy or move.
+    // e.g. Emplace<CollisionEvent>(entityA, entityB);
+    // ==================================================================
+    template <IsEvent T, class... Args>
+        requires std::constructible_from<T, Args...>
+    void Emplace(Args&&... args)
+    {
+        Emplace<T>(JobOptions{}, std::forward<Args>(args)...);
+    }
+
+    // Same as Emplace() with explicit options, see Publish().
+    template <IsEvent T, class... Args>
+        requires std::constructible_from<T, Args...>
+    void Emplace(const JobOptions& options, Args&&... args)
+    {
+        std::shared_ptr<const TypeEntry> entry = FindEntry(T::GetStaticTypeId());
+        if (Batch<T>* batch = FindBatch<T>(entry.get()))
+        {
+            // Ordered handlers copy the event, so it is built up front only for them
+            if (entry->OrderedHandlers.empty())
+            {
+                batch->Add(std::forward<Args>(args)...);
+            }
+            else
+            {
+                T event(std::forward<Args>(args)...);
+                PostOrdered(entry.get(), event);
+                batch->Add(std::move(event));
+            }
+            return;
+        }
+
+        PooledEvent event = PooledEvent::Create<T>(std::forward<Args>(args)...);
+        PostOrdered(entry.get(), *event);
+        PublishInternal(entry.get(), std::move(event), options);
+    }
+
+    // ==================================================================
+    // 5. PUBLISH MANY (Fire and Forget)
+    // Same as Publish() for a whole set of events, submitted as one
+    // JobSystem batch: one queue lock and one round of wake-ups instead
+    // of one per event. Each event is still dispatched in its own job.
+    // ==================================================================
+    template <IsEvent T> void PublishBatch(std::span<const T> events, const JobOptions& options = {})
+    {
+        std::shared_ptr<const TypeEntry> entry = FindEntry(T::GetStaticTypeId());
+        for (const T& event : events)
+        {
+            PostOrdered(entry.get(), event);
+        }
+
+        if (Batch<T>* batch = FindBatch<T>(entry.get()))
+        {
+            batch->AddRange(events);
+            return;
+        }
+
+        std::vector<PooledEvent> pooled;
+        pooled.reserve(events.size());
+        for (const T& event : events)
+        {
+            pooled.push_back(PooledEvent::Create<T>(event));
+        }
+
+        PublishBatchInternal(entry.get(), pooled, options);
+    }
+
+    // ==================================================================
+    // 6. BATCHING (Opt-in, per event type)
+    // From now on, events of type T are collected instead of dispatched
+    // one job each, and every batch is dispatched as a single job: one
+    // submission, one subscriber lookup and contiguous events for the
+    // handlers. A batch goes out once config.MaxEvents events are pending
+    // and/or at the end of the frame. Calling it again updates the config.
+    // If T declares a ConflationPolicy, superseded events are coalesced
+    // within the batch: e.g. per-frame telemetry that only needs its
+    // latest value reaches the handlers once per frame. Ordered handlers
+    // are not batched: they still receive every event, in order.
+    // ==================================================================
+    template <IsEvent T> void EnableBatching(const EventBatchConfig& config = {})
+    {
+        EnableBatchingInternal(T::GetStaticTypeId(), config, [](const EventBatchConfig& batchConfig)
+                               { return std::shared_ptr<BatchBase>(std::make_shared<Batch<T>>(batchConfig)); });
+    }
+
+    // ==================================================================
+    // 7. BOUNDED QUEUES (Opt-in, per event type)
+    // By default publishing never refuses an event, so handlers slower
+    // than their publishers let the job queues (and the memory behind
+    // them) grow without limit. From now on at most config.Capacity
+    // events of type T wait for a worker; what happens to the ones
+    // published beyond that is up to config.Policy. Pending events live
+    // in a ring allocated up front, so memory stays flat under sustained
+    // overload. Calling it again updates the config. A type is either
+    // batched or limited, not both. Ordered handlers are not limited:
+    // their strands queue every event.
+    // ==================================================================
+    template <IsEvent T> void LimitQueue(const EventQueueConfig& config = {})
+    {
+        LimitQueueInternal(T::GetStaticTypeId(), config);
     }
 
+    // Gets the counters of T's queue: dropped and held-back publishes,
+    // pending events. All zero if T is not limited.
+    template <IsEvent T> EventQueueStats GetQueueStats() const
+    {
+        return GetQueueStatsInternal(T::GetStaticTypeId());
+    }
+
+    // Dispatches the pending events of every batched type now.
+    void Flush();
+
+    // Dispatches the pending events of the types batched per frame.
+    // Called by Application::Run() once the layers are done for the frame.
+    void EndFrame();
+
 private:
+    // A handler of whole batches: 'first' is the first of 'count' contiguous events of the subscribed type.
+    using BatchHandler = std::function<void(Event& first, std::size_t count)>;
+
+    // Queues a copy of the event for an ordered or main-thread handler. Called by the publisher.
+    using OrderedHandler = std::function<void(const Event&)>;
+
+    // The pending events of one batched type. Never destroyed before the bus, so jobs and publishers may keep
+    // pointers to it.
+    class BatchBase
+    {
+    public:
+        BatchBase(const EventBatchConfig& config, const void* tag) : m_Config(config), m_Tag(tag) {}
+        virtual ~BatchBase() = default;
+
+        // Identifies the event class the batch stores, see s_BatchTag.
+        inline const void* GetTag() const { return m_Tag; }
+
+        void SetConfig(const EventBatchConfig& config)
+        {
+            std::scoped_lock lock(m_Mutex);
+            m_Config = config;
+        }
+
+        // Submits the pending events as one job, if any. 'endOfFrame' only flushes per-frame batches.
+        virtual void Flush(bool endOfFrame) = 0;
+
+    protected:
+        std::mutex       m_Mutex;
+        EventBatchConfig m_Config;
+
+    private:
+        const void* m_Tag;
+    };
+
+    template <IsEvent T> class Batch;
+
+    // The events of a limited type waiting for a worker, see LimitQueue(). Never destroyed before the bus either.
+    class BoundedQueue;
+
+    // One distinct address per event class. Classes derived from a batched event share its type ID, but not its
+    // storage, so FindBatch() checks the tag too; such events are dispatched one by one.
+    template <class T> static constexpr char s_BatchTag = 0;
+
+    // Everything the bus knows about one event type.
+    struct TypeEntry
+    {
+        std::vector<EventHandler>     Handlers;
+        std::vector<EventHandler>     IndependentHandlers;
+        std::vector<OrderedHandler>   OrderedHandlers;
+        std::vector<BatchHandler>     BatchHandlers;
+        std::shared_ptr<BatchBase>    Batch;
+        std::shared_ptr<BoundedQueue> Queue;
+    };
+
     // Hidden implementation details to keep header clean
     AsyncEventBus() = default;
-    void SubscribeInternal(std::type_index type, EventHandler handler);
-    void PublishInternal(std::shared_ptr<Event> event);
+    void SubscribeInternal(EventTypeId type, EventHandler handler, const SubscribeOptions& options);
+    void SubscribeBatchInternal(EventTypeId type, BatchHandler handler);
+    void SubscribeOrderedInternal(EventTypeId type, OrderedHandler handler);
+    void PublishInternal(const TypeEntry* entry, PooledEvent event, const JobOptions& options,
+                         EventHandler onComplete = {});
+    void PublishBatchInternal(const TypeEntry* entry, std::span<PooledEvent> events, const JobOptions& options);
+    void EnableBatchingInternal(EventTypeId type, const EventBatchConfig& config,
+                                std::shared_ptr<BatchBase> (*create)(const EventBatchConfig&));
+    void LimitQueueInternal(EventTypeId type, const EventQueueConfig& config);
+    EventQueueStats GetQueueStatsInternal(EventTypeId type) const;
+
+    // Replaces the entry of a type with an updated copy, see m_Subscribers.
+    void UpdateEntry(EventTypeId type, const std::function<void(TypeEntry&)>& update);
+
+    // Gets the current entry of a type, or null if the bus knows nothing about it.
+    std::shared_ptr<const TypeEntry> FindEntry(EventTypeId type) const;
+
+    // Gets the batch of T from its entry, or null if T is not batched.
+    template <IsEvent T> static Batch<T>* FindBatch(const TypeEntry* entry)
+    {
+        if (!entry || !entry->Batch || entry->Batch->GetTag() != &s_BatchTag<T>)
+        {
+            return nullptr;
+        }
+        return static_cast<Batch<T>*>(entry->Batch.get());
+    }
+
+    static JobSystem&          GetJobSystem();
+    static MainThreadExecutor& GetMainThreadExecutor();
+
+    // Hands the event to the ordered and main-thread handlers of its type. Called by the publisher, before the event
+    // is batched, limited or dispatched, so they see every event and in publish order.
+    static void PostOrdered(const TypeEntry* entry, const Event& event)
+    {
+        if (!entry)
+        {
+            return;
+        }
+
+        for (const OrderedHandler& post : entry->OrderedHandlers)
+        {
+            post(event);
+        }
+    }
+
+    // An event shared by the jobs its handlers are fanned out to, see FanOut().
+    struct FanOutState;
+
+    // Runs the handlers subscribed to the event's type, then 'onComplete' if any. Called on a worker.
+    void Dispatch(PooledEvent event, EventHandler onComplete, const JobOptions& options);
+
+    // Submits a job per independent handler and runs the others meanwhile. The last job done calls 'onComplete'.
+    void FanOut(std::shared_ptr<const TypeEntry> entry, PooledEvent event, EventHandler onComplete,
+                const JobOptions& options);
+
+    // Runs the handlers of an entry that are not independent, in subscription order.
+    static void RunHandlers(const TypeEntry& entry, Event& event);
+
+    // Runs the handlers subscribed to T on a whole batch. Called on a worker.
+    template <IsEvent T> void DispatchBatch(std::span<T> events)
+    {
+        ZoneScoped;
+        ZoneName(T::Name, std::char_traits<char>::length(T::Name));
+        ZoneValue(events.size());
+
+        std::shared_ptr<const TypeEntry> entry = FindEntry(T::GetStaticTypeId());
+        if (!entry || events.empty())
+        {
+            return;
+        }
+
+        for (const BatchHandler& handler : entry->BatchHandlers)
+        {
+            handler(events.front(), events.size());
+        }
+
+        // Plain handlers see the events one by one; each runs over the whole batch while its code is hot. The batch
+        // already spreads the work over jobs, so independent handlers run here too.
+        for (const std::vector<EventHandler>* handlers : {&entry->Handlers, &entry->IndependentHandlers})
+        {
+            for (const EventHandler& handler : *handlers)
+            {
+                for (T& event : events)
+                {
+                    handler(event);
+                }
+            }
+        }
+    }
 
 private:
-    // Map Key: The type of event (e.g., Type of 'PlayerJumpEvent')
-    // Map Value: A list of functions to call
-    std::unordered_map<std::type_index, std::vector<EventHandler>> m_Subscribers;
+    // Index: The type ID of the event (e.g., ID of 'PlayerJumpEvent', see GetEventTypeId())
+    // Value: The handlers and batching of that type, or null if the bus knows nothing about it
+    using SubscriberTable = std::vector<std::shared_ptr<const TypeEntry>>;
+
+    // Copy-on-write: the table and its entries are never modified once published. Subscribing builds a new table that
+    // shares the untouched entries and swaps it in; dispatching just loads the current one, without locking the bus or
+    // copying handlers, and keeps it alive until its handlers have run.
+    std::atomic<std::shared_ptr<const SubscriberTable>> m_Subscribers;
 
+    // Serializes subscribers only, so concurrent subscriptions do not overwrite each other's snapshot.
     std::mutex m_Mutex;
 };
 
+// ==================================================================
+// BATCH STORAGE
+// Events are stored by value in a vector, so a batch is contiguous.
+// Types with a ConflationPolicy other than KeepAll keep a single
+// pending event that later ones are folded into.
+// Vectors of dispatched batches are kept and reused, so a steady
+// stream does not allocate once the vectors have grown.
+// ==================================================================
+template <IsEvent T> class AsyncEventBus::Batch final : public AsyncEventBus::BatchBase
+{
+public:
+    explicit Batch(const EventBatchConfig& config) : BatchBase(config, &s_BatchTag<T>) {}
+
+    template <class... Args> void Add(Args&&... args)
+    {
+        std::vector<T> full;
+        JobOptions     options;
+        {
+            std::scoped_lock lock(m_Mutex);
+            Store(std::forward<Args>(args)...);
+            if (m_Config.MaxEvents == 0 || m_Pending.size() < m_Config.MaxEvents)
+            {
+                return;
+            }
+            full.swap(m_Pending);
+            options = m_Config.Options;
+        }
+        Submit(std::move(full), options);
+    }
+
+    // Adds all events under one lock. The resulting batch may exceed MaxEvents.
+    void AddRange(std::span<const T> events)
+    {
+        std::vector<T> full;
+        JobOptions     options;
+        {
+            std::scoped_lock lock(m_Mutex);
+            if constexpr (kConflation == ConflationPolicy::KeepAll)
+            {
+                TakeSpare();
+                m_Pending.insert(m_Pending.end(), events.begin(), events.end());
+            }
+            else
+            {
+                for (const T& event : events)
+                    Store(event);
+            }
+            if (m_Config.MaxEvents == 0 || m_Pending.size() < m_Config.MaxEvents)
+            {
+                return;
+            }
+            full.swap(m_Pending);
+            options = m_Config.Options;
+        }
+        Submit(std::move(full), options);
+    }
+
+    void Flush(bool endOfFrame) override
+    {
+        std::vector<T> pending;
+        JobOptions     options;
+        {
+            std::scoped_lock lock(m_Mutex);
+            if (m_Pending.empty() || (endOfFrame && !m_Config.FlushEveryFrame))
+            {
+                return;
+            }
+            pending.swap(m_Pending);
+            options = m_Config.Options;
+        }
+        Submit(std::move(pending), options);
+    }
+
+private:
+    static constexpr std::size_t      kMaxSpareBatches = 8;
+    static constexpr ConflationPolicy kConflation      = GetConflationPolicy<T>();
+
+    // Appends an event to the pending batch, or folds it into the pending one if T is conflated, so a batch holds
+    // at most one event of a conflated type. Called with the mutex held.
+    template <class... Args> void Store(Args&&... args)
+    {
+        TakeSpare();
+        if constexpr (kConflation != ConflationPolicy::KeepAll)
+        {
+            if (!m_Pending.empty())
+            {
+                Conflate(m_Pending.back(), T(std::forward<Args>(args)...));
+                return;
+            }
+        }
+        m_Pending.emplace_back(std::forward<Args>(args)...);
+    }
+
+    // Starts a new batch in a recycled vector. Called with the mutex held.
+    void TakeSpare()
+    {
+        if (m_Pending.empty() && !m_Spare.empty())
+        {
+            m_Pending = std::move(m_Spare.back());
+            m_Spare.pop_back();
+        }
+    }
+
+    void Submit(std::vector<T> events, const JobOptions& options)
+    {
+        GetJobSystem().SubmitDetached(options,
+                                      [this, events = std::move(events)]() mutable
+                                      {
+                                          AsyncEventBus::Get().DispatchBatch<T>(std::span<T>(events));
+                                          Recycle(std::move(events));
+                                      });
+    }
+
+    void Recycle(std::vector<T> events)
+    {
+        events.clear();
+        std::scoped_lock lock(m_Mutex);
+        if (m_Spare.size() < kMaxSpareBatches)
+        {
+            m_Spare.push_back(std::move(events));
+        }
+    }
+
+private:
+    std::vector<T>              m_Pending;
+    std::vector<std::vector<T>> m_Spare;
+};
+
 } // namespace Nodens
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "Event.h"
+
+#include "ndpch.h"
+
+#include <atomic>
+
+namespace Nodens
+{
+
+// The next free ID, also the number of IDs handed out.
+static std::atomic<EventTypeId> s_NextEventTypeId = 0;
+
+namespace Detail
+{
+
+EventTypeId AllocateEventTypeId()
+{
+    return s_NextEventTypeId.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace Detail
+
+EventTypeId GetEventTypeCount()
+{
+    return s_NextEventTypeId.load(std::memory_order_relaxed);
+}
+
+} // namespace Nodens
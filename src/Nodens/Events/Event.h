@@ -1,6 +1,7 @@
 #pragma once
 
 #include <concepts> // C++20: Required for 'concept' keyword
+#include <cstdint>
 #include <functional>
 #include <sstream>
 #include <string>
@@ -44,7 +45,31 @@ enum EventCategory
     EventCategoryMouseButton = Bit(4)
 };
 
+/// @brief A dense integer identifying an event class, built-in or user-defined. See GetEventTypeId().
+using EventTypeId = uint32_t;
+
+namespace Detail
+{
+
+/// @brief Hands out the next unused event type ID, starting at 0. Thread-safe.
+EventTypeId AllocateEventTypeId();
+
+} // namespace Detail
+
+/// @brief Gets the ID of an event class, assigned the first time the class asks for it.
+/// @details IDs are dense, so they can index flat arrays (see AsyncEventBus), and any number of event classes can
+/// be added without touching the EventType enum. They are only stable within one run of the program.
+template <typename T> EventTypeId GetEventTypeId()
+{
+    static const EventTypeId id = Detail::AllocateEventTypeId();
+    return id;
+}
+
+/// @brief Gets the number of event type IDs handed out so far.
+EventTypeId GetEventTypeCount();
+
 /// @brief The abstract base class for all events.
+/// @details Concrete events derive from EventImpl, which stamps them with the ID of their class.
 class Event
 {
     friend class EventDispatcher;
@@ -52,6 +77,9 @@ class Event
 public:
     virtual ~Event() = default;
 
+    /// @brief Gets the ID of the event's class (see GetEventTypeId()), without a virtual call.
+    inline EventTypeId GetTypeId() const { return m_TypeId; }
+
     /// @brief Gets the specific runtime type of the event.
     virtual EventType GetEventType() const = 0;
 
@@ -71,6 +99,13 @@ public:
     /// @brief Flag indicating if the event has been handled.
     /// @details If true, subsequent layers usually ignore this event.
     bool Handled = false;
+
+protected:
+    /// @brief Protected constructor: the ID is provided by EventImpl (or an equivalent helper).
+    explicit Event(EventTypeId typeId) : m_TypeId(typeId) {}
+
+private:
+    EventTypeId m_TypeId;
 };
 
 // -------------------------------------------------------------------------
@@ -79,12 +114,17 @@ public:
 // -------------------------------------------------------------------------
 
 /// @brief A Helper class to automate the implementation of virtual functions.
+/// @details User-defined events derive from EventImpl<MyEvent> as well; they get an ID of their own and need no
+/// EventType value.
 /// @tparam Derived The concrete event class (e.g., WindowResizeEvent).
-/// @tparam Type The EventType enum value for this class.
-template <typename Derived, EventType Type> class EventImpl : public Event
+/// @tparam Type The EventType enum value for this class, for built-in events.
+template <typename Derived, EventType Type = EventType::None> class EventImpl : public Event
 {
 public:
-    /// @brief Static access to the event type, required by EventDispatcher.
+    /// @brief Static access to the event type ID, required by EventDispatcher and AsyncEventBus.
+    static EventTypeId GetStaticTypeId() { return GetEventTypeId<Derived>(); }
+
+    /// @brief Static access to the event type.
     static constexpr EventType GetStaticType() { return Type; }
 
     /// @brief Implements pure virtual GetEventType() from base Event.
@@ -96,15 +136,67 @@ public:
     /// @brief Implements pure virtual GetCategoryFlags() using static data in
     /// Derived.
     virtual int GetCategoryFlags() const override { return Derived::Category; }
+
+protected:
+    EventImpl() : Event(GetStaticTypeId()) {}
 };
 
+// -------------------------------------------------------------------------
+// CONFLATION
+// -------------------------------------------------------------------------
+
+/// @brief What happens to an event of a type when another one of the same type arrives before it was delivered.
+/// @details Events declare theirs with a static member, e.g.
+/// `static constexpr ConflationPolicy Conflation = ConflationPolicy::LatestWins;`. Applied by EventConflator
+/// (window input) and by AsyncEventBus to batched types (see AsyncEventBus::EnableBatching()).
+enum class ConflationPolicy : uint8_t
+{
+    /// @brief Every event is delivered. The default.
+    KeepAll,
+
+    /// @brief Only the newest pending event is delivered, e.g. positions and sizes.
+    LatestWins,
+
+    /// @brief Pending events are merged into one with `void Accumulate(const T& next)`, e.g. scroll deltas.
+    Accumulate,
+};
+
+/// @brief Gets the conflation policy an event class declares, or KeepAll if it declares none.
+template <typename T> constexpr ConflationPolicy GetConflationPolicy()
+{
+    if constexpr (requires { T::Conflation; })
+        return T::Conflation;
+    else
+        return ConflationPolicy::KeepAll;
+}
+
+/// @brief Folds a newer event into a pending one of the same type, according to the type's conflation policy.
+template <typename T> void Conflate(T& pending, T&& next)
+{
+    constexpr ConflationPolicy policy = GetConflationPolicy<T>();
+    static_assert(policy != ConflationPolicy::KeepAll, "KeepAll events are never conflated.");
+
+    if constexpr (policy == ConflationPolicy::LatestWins)
+    {
+        pending = std::move(next);
+    }
+    else
+    {
+        static_assert(requires(T& a, const T& b) { a.Accumulate(b); },
+                      "ConflationPolicy::Accumulate requires 'void Accumulate(const T& next)'.");
+        pending.Accumulate(next);
+    }
+}
+
 // -------------------------------------------------------------------------
 // C++20 DISPATCHER
 // -------------------------------------------------------------------------
 
-/// @brief A Concept ensuring type T inherits from the base Event class.
+/// @brief A Concept ensuring type T inherits from the base Event class and has a type ID.
 template <typename T>
-concept IsEvent = std::derived_from<T, Event>;
+concept IsEvent = std::derived_from<T, Event> && requires {
+    { T::GetStaticTypeId() } -> std::same_as<EventTypeId>;
+};
 
 /// @brief Utility class for dispatching events based on their runtime type.
 class EventDispatcher
@@ -119,9 +211,9 @@ public:
     /// @return True if the event types matched and the function was executed.
     template <IsEvent T, typename F> bool Dispatch(const F& func)
     {
-        if (m_Event.GetEventType() == T::GetStaticType())
+        if (m_Event.GetTypeId() == T::GetStaticTypeId())
         {
-            // Safe cast because we verified the type enum above.
+            // Safe cast because we verified the type ID above.
             m_Event.Handled |= func(static_cast<T&>(m_Event));
             return true;
         }
@@ -0,0 +1,28 @@
+#include "EventConflator.h"
+
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+namespace Nodens
+{
+
+void EventConflator::Flush(const DeliverFn& deliver)
+{
+    if (m_Pending.empty())
+        return;
+
+    ZoneScoped;
+
+    // Handlers may post again (e.g. a layer reacting to a resize), so deliver from a detached list.
+    std::vector<PooledEvent> pending;
+    pending.swap(m_Pending);
+    for (PooledEvent& event : pending)
+        deliver(*event);
+
+    // Keep whichever buffer has the capacity, so a steady stream does not allocate.
+    pending.clear();
+    if (m_Pending.empty())
+        m_Pending.swap(pending);
+}
+
+} // namespace Nodens
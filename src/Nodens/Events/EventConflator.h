@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Nodens/Events/Event.h"
+#include "Nodens/Events/PooledEvent.h"
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Nodens
+{
+
+/// @brief Coalesces bursts of high-frequency events before they are delivered.
+/// @details Events of conflated types (see ConflationPolicy) are held back and folded together until Flush(), so
+/// a burst of them, e.g. the hundreds of mouse moves GLFW reports in one poll, reaches the handlers once. Events of
+/// every other type are delivered right away, after the held-back ones, so the relative order of different kinds of
+/// events is kept: a click is always preceded by the latest move before it. Used by the main thread only.
+class EventConflator
+{
+public:
+    using DeliverFn = std::function<void(Event&)>;
+
+    /// @brief Delivers the event now, or holds it back (folded into a pending one of its type) until Flush().
+    template <IsEvent T> void Post(T event, const DeliverFn& deliver)
+    {
+        if constexpr (GetConflationPolicy<T>() == ConflationPolicy::KeepAll)
+        {
+            Flush(deliver);
+            deliver(event);
+        }
+        else
+        {
+            for (PooledEvent& pending : m_Pending)
+            {
+                if (pending->GetTypeId() == T::GetStaticTypeId())
+                {
+                    Conflate(static_cast<T&>(*pending), std::move(event));
+                    return;
+                }
+            }
+            m_Pending.push_back(PooledEvent::Create<T>(std::move(event)));
+        }
+    }
+
+    /// @brief Delivers the held-back events, one per type, in the order their types first arrived.
+    void Flush(const DeliverFn& deliver);
+
+private:
+    std::vector<PooledEvent> m_Pending;
+};
+
+} // namespace Nodens
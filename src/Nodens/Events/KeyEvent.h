@@ -23,7 +23,7 @@ public:
 
 protected:
     /// @brief Protected constructor to force usage of derived classes.
-    KeyEvent(int keycode) : m_KeyCode(keycode) {}
+    KeyEvent(EventTypeId typeId, int keycode) : Event(typeId), m_KeyCode(keycode) {}
 
     int m_KeyCode;
 };
@@ -38,6 +38,9 @@ protected:
 template <typename Derived, EventType Type> class KeyEventImpl : public KeyEvent
 {
 public:
+    /// @brief Static Type ID Accessor.
+    static EventTypeId GetStaticTypeId() { return GetEventTypeId<Derived>(); }
+
     /// @brief Static Type Accessor.
     static constexpr EventType GetStaticType() { return Type; }
 
@@ -48,7 +51,7 @@ public:
     virtual const char* GetName() const override { return Derived::Name; }
 
     // Pass keycode up to the abstract base
-    KeyEventImpl(int keycode) : KeyEvent(keycode) {}
+    KeyEventImpl(int keycode) : KeyEvent(GetStaticTypeId(), keycode) {}
 };
 
 // -------------------------------------------------------------------------
@@ -16,8 +16,9 @@ namespace Nodens
 class MouseMovedEvent : public EventImpl<MouseMovedEvent, EventType::MouseMoved>
 {
 public:
-    static constexpr char Name[]   = "MouseMoved";
-    static constexpr int  Category = EventCategoryMouse | EventCategoryInput;
+    static constexpr char             Name[]     = "MouseMoved";
+    static constexpr int              Category   = EventCategoryMouse | EventCategoryInput;
+    static constexpr ConflationPolicy Conflation = ConflationPolicy::LatestWins;
 
     MouseMovedEvent(float x, float y) : m_MouseX(x), m_MouseY(y) {}
 
@@ -43,8 +44,9 @@ private:
 class MouseScrolledEvent : public EventImpl<MouseScrolledEvent, EventType::MouseScrolled>
 {
 public:
-    static constexpr char Name[]   = "MouseScrolled";
-    static constexpr int  Category = EventCategoryMouse | EventCategoryInput;
+    static constexpr char             Name[]     = "MouseScrolled";
+    static constexpr int              Category   = EventCategoryMouse | EventCategoryInput;
+    static constexpr ConflationPolicy Conflation = ConflationPolicy::Accumulate;
 
     /// @brief Constructor.
     /// @param xOffset The horizontal scroll amount (usually 0).
@@ -54,6 +56,13 @@ public:
     inline float GetXOffset() const { return m_XOffset; }
     inline float GetYOffset() const { return m_YOffset; }
 
+    /// @brief Adds the offsets of a later scroll, see ConflationPolicy::Accumulate.
+    void Accumulate(const MouseScrolledEvent& next)
+    {
+        m_XOffset += next.m_XOffset;
+        m_YOffset += next.m_YOffset;
+    }
+
     std::string ToString() const override
     {
         std::stringstream ss;
@@ -81,7 +90,7 @@ public:
     }
 
 protected:
-    MouseButtonEvent(int button) : m_Button(button) {}
+    MouseButtonEvent(EventTypeId typeId, int button) : Event(typeId), m_Button(button) {}
 
     int m_Button;
 };
@@ -94,11 +103,12 @@ protected:
 template <typename Derived, EventType Type> class MouseButtonEventImpl : public MouseButtonEvent
 {
 public:
+    static EventTypeId         GetStaticTypeId() { return GetEventTypeId<Derived>(); }
     static constexpr EventType GetStaticType() { return Type; }
     virtual EventType          GetEventType() const override { return GetStaticType(); }
     virtual const char*        GetName() const override { return Derived::Name; }
 
-    MouseButtonEventImpl(int button) : MouseButtonEvent(button) {}
+    MouseButtonEventImpl(int button) : MouseButtonEvent(GetStaticTypeId(), button) {}
 };
 
 // -------------------------------------------------------------------------
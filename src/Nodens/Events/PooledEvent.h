@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Nodens/Events/Event.h"
+#include "Nodens/Memory/BlockPool.h"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Nodens
+{
+
+/// @brief Owning handle to an event constructed in place in a pooled block.
+/// @details Events of the same size class share a BlockPool, so once the pools are warm creating and releasing an
+/// event never touches the heap. The handle is move-only and as small as two pointers, so it fits inline in a job;
+/// when the handle is dropped (the last handler has run, or the job was discarded) the event is destroyed and its
+/// block recycled. Events larger than kMaxPooledSize, or aligned beyond a cache line, come from the heap.
+class PooledEvent
+{
+public:
+    /// @brief Events up to this size come from block pools, larger ones from the heap.
+    static constexpr std::size_t kMaxPooledSize = 1024;
+
+    PooledEvent() = default;
+
+    /// @brief Constructs a T from 'args' in a pooled block.
+    template <IsEvent T, class... Args> static PooledEvent Create(Args&&... args)
+    {
+        void* block = Allocate<T>();
+        return PooledEvent(::new (block) T(std::forward<Args>(args)...), &Release<T>);
+    }
+
+    PooledEvent(PooledEvent&& other) noexcept
+        : m_Event(std::exchange(other.m_Event, nullptr)), m_Release(other.m_Release)
+    {
+    }
+
+    PooledEvent& operator=(PooledEvent&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_Event   = std::exchange(other.m_Event, nullptr);
+            m_Release = other.m_Release;
+        }
+        return *this;
+    }
+
+    PooledEvent(const PooledEvent&)            = delete;
+    PooledEvent& operator=(const PooledEvent&) = delete;
+
+    ~PooledEvent() { Reset(); }
+
+    /// @brief Destroys the event, if any, and recycles its block.
+    void Reset()
+    {
+        if (m_Event)
+            m_Release(std::exchange(m_Event, nullptr));
+    }
+
+    inline Event& operator*() const { return *m_Event; }
+    inline Event* operator->() const { return m_Event; }
+    inline Event* Get() const { return m_Event; }
+
+    inline explicit operator bool() const { return m_Event != nullptr; }
+
+private:
+    using ReleaseFn = void (*)(Event*);
+
+    PooledEvent(Event* event, ReleaseFn release) : m_Event(event), m_Release(release) {}
+
+    /// @brief The size class of T: its size rounded up to whole cache lines.
+    template <class T> static constexpr std::size_t GetBlockSize()
+    {
+        return (sizeof(T) + kCacheLineSize - 1) / kCacheLineSize * kCacheLineSize;
+    }
+
+    template <class T> static constexpr bool IsPooled()
+    {
+        return GetBlockSize<T>() <= kMaxPooledSize && alignof(T) <= kCacheLineSize;
+    }
+
+    template <class T> static void* Allocate()
+    {
+        if constexpr (IsPooled<T>())
+            return BlockPool<GetBlockSize<T>()>::Allocate();
+        else
+            return ::operator new(sizeof(T), std::align_val_t{alignof(T)});
+    }
+
+    template <class T> static void Release(Event* event)
+    {
+        T* typed = static_cast<T*>(event);
+        std::destroy_at(typed);
+        if constexpr (IsPooled<T>())
+            BlockPool<GetBlockSize<T>()>::Free(typed);
+        else
+            ::operator delete(typed, std::align_val_t{alignof(T)});
+    }
+
+private:
+    Event*    m_Event   = nullptr;
+    ReleaseFn m_Release = nullptr;
+};
+
+} // namespace Nodens
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "Nodens/Core.h"
+#include "Nodens/Memory/BlockPool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
+
+namespace Nodens
+{
+
+/// @brief Counters that make the cost of job creation observable.
+/// @details A job costs a heap allocation only when the pool has to grow by a chunk or when its
+/// callable does not fit the inline storage. On a warm pool with small callables both stay flat.
+/// The counters are only touched on those slow paths, so reading them costs the hot path nothing.
+struct JobAllocationStats
+{
+    /// @brief Jobs whose callable was too large for the inline storage and went to the heap.
+    uint64_t OversizedJobs = 0;
+
+    /// @brief Chunks the job pool requested from the heap.
+    uint64_t ChunkAllocations = 0;
+
+    /// @brief Number of job slots owned by the pool.
+    uint64_t SlotCapacity = 0;
+
+    /// @brief Total heap allocations caused by job creation.
+    inline uint64_t GetHeapAllocations() const { return OversizedJobs + ChunkAllocations; }
+};
+
+/// @brief Scheduling class of a job. Workers take the highest non-empty priority first, with starvation
+/// protection for the lower ones (see JobSystem::kStarvationLimitNs).
+enum class JobPriority : uint8_t
+{
+    /// @brief Work the current frame is waiting on.
+    Critical = 0,
+
+    /// @brief The default for everything else.
+    Normal,
+
+    /// @brief Throughput work that may be delayed by a few frames (streaming, analytics, ...).
+    Background,
+};
+
+/// @brief Number of JobPriority values.
+inline constexpr std::size_t kJobPriorityCount = 3;
+
+/// @brief A unit of work, type-erased into a pooled, cache-line-aligned slot.
+/// @details The callable is constructed in place inside the slot, so creating a job does not allocate
+/// as long as the callable fits kInlineCapacity. Jobs never move once created; queues only pass the
+/// pointer around, which keeps move-only callables (e.g. std::packaged_task) cheap to store.
+class alignas(kCacheLineSize) Job
+{
+public:
+    /// @brief Total footprint of a job slot: two cache lines.
+    static constexpr std::size_t kSize = 2 * kCacheLineSize;
+
+    /// @brief Bytes reserved at the front of the slot for the job's own bookkeeping.
+    static constexpr std::size_t kHeaderSize = 32;
+
+    /// @brief Bytes available for the callable before it spills to the heap.
+    static constexpr std::size_t kInlineCapacity = kSize - kHeaderSize;
+
+    /// @brief Creates a job holding a copy of 'f'.
+    /// @tparam F The callable type. Must be invocable without arguments.
+    /// @param f The callable to store.
+    /// @return A job owned by the caller until it is run or discarded.
+    template <class F> static Job* Create(F&& f)
+    {
+        using Callable = std::decay_t<F>;
+
+        Job* job = new (Pool::Allocate()) Job();
+
+        if constexpr (FitsInline<Callable>())
+        {
+            ::new (static_cast<void*>(job->m_Storage)) Callable(std::forward<F>(f));
+            job->m_Invoke = &InvokeInline<Callable>;
+        }
+        else
+        {
+            s_OversizedJobs.fetch_add(1, std::memory_order_relaxed);
+            ::new (static_cast<void*>(job->m_Storage)) Callable*(new Callable(std::forward<F>(f)));
+            job->m_Invoke = &InvokeHeap<Callable>;
+        }
+        return job;
+    }
+
+    /// @brief Runs the callable, then destroys the job and returns its slot to the pool.
+    /// @details While the callable runs, the job's stop token is the calling thread's current one.
+    /// @warning Exceptions escaping a job terminate the application, like they would on a std::thread.
+    void Run()
+    {
+        // Helping waits run jobs inside jobs, so the outer job's token is restored afterwards.
+        const std::stop_token* previous = std::exchange(t_CurrentStopToken, &m_StopToken);
+        m_Invoke(this, true);
+        t_CurrentStopToken = previous;
+    }
+
+    /// @brief Destroys the job without running it and returns its slot to the pool.
+    void Discard() { m_Invoke(this, false); }
+
+    /// @brief Records the queue a job is pushed to and when. Set by the JobSystem on submission.
+    inline void MarkQueued(JobPriority priority, int64_t time)
+    {
+        m_Priority    = priority;
+        m_EnqueueTime = time;
+    }
+
+    /// @brief Attaches the stop token of the cancellation group the job belongs to.
+    inline void SetStopToken(std::stop_token token) { m_StopToken = std::move(token); }
+
+    /// @brief Gets the stop token of the job running on the calling thread.
+    /// @return The token, or an empty one (never stopped) outside of jobs or for jobs without a group.
+    static const std::stop_token& GetCurrentStopToken()
+    {
+        static const std::stop_token kNoStopToken;
+        return t_CurrentStopToken ? *t_CurrentStopToken : kNoStopToken;
+    }
+
+    /// @brief Gets the priority the job was queued with.
+    inline JobPriority GetPriority() const { return m_Priority; }
+
+    /// @brief Gets the time the job was queued at, in steady clock nanoseconds. Only recorded with telemetry or
+    /// profiling enabled, 0 otherwise.
+    inline int64_t GetEnqueueTime() const { return m_EnqueueTime; }
+
+    /// @brief Gets the allocation counters of the job pool.
+    static JobAllocationStats GetAllocationStats()
+    {
+        BlockPoolStats pool = Pool::GetStats();
+        return {s_OversizedJobs.load(std::memory_order_relaxed), pool.ChunkAllocations, pool.BlockCapacity};
+    }
+
+private:
+    using Pool     = BlockPool<kSize>;
+    using InvokeFn = void (*)(Job*, bool run);
+
+    Job() = default;
+
+    template <class Callable> static constexpr bool FitsInline()
+    {
+        return sizeof(Callable) <= kInlineCapacity && alignof(Callable) <= alignof(std::max_align_t);
+    }
+
+    template <class Callable> static void InvokeInline(Job* job, bool run)
+    {
+        Callable* callable = std::launder(reinterpret_cast<Callable*>(job->m_Storage));
+        if (run)
+            (*callable)();
+        std::destroy_at(callable);
+        Release(job);
+    }
+
+    template <class Callable> static void InvokeHeap(Job* job, bool run)
+    {
+        Callable* callable = *std::launder(reinterpret_cast<Callable**>(job->m_Storage));
+        if (run)
+            (*callable)();
+        delete callable;
+        Release(job);
+    }
+
+    static void Release(Job* job)
+    {
+        std::destroy_at(job);
+        Pool::Free(job);
+    }
+
+private:
+    /// @brief Type-erased entry point. Runs (optionally) and destroys the stored callable.
+    InvokeFn m_Invoke = nullptr;
+
+    /// @brief Scheduling metadata, see MarkQueued().
+    int64_t     m_EnqueueTime = 0;
+    JobPriority m_Priority    = JobPriority::Normal;
+
+    /// @brief Stopped when the job's cancellation group is cancelled. Empty for most jobs.
+    std::stop_token m_StopToken;
+
+    /// @brief In-place storage for the callable (or a pointer to it, when oversized).
+    alignas(std::max_align_t) std::byte m_Storage[kInlineCapacity];
+
+    static inline std::atomic<uint64_t> s_OversizedJobs = 0;
+
+    /// @brief Token of the job running on this thread, see GetCurrentStopToken().
+    static inline thread_local const std::stop_token* t_CurrentStopToken = nullptr;
+};
+
+static_assert(sizeof(Job) == Job::kSize, "Job must fill exactly its pool slot.");
+
+/// @brief A growable ring buffer of job pointers usable as a deque.
+/// @details Unlike std::deque it never frees memory while in use, so a steady stream of pushes and pops
+/// does not allocate. Not thread-safe; the owner guards it with a mutex.
+class JobQueue
+{
+public:
+    JobQueue() : m_Buffer(std::make_unique<Job*[]>(kInitialCapacity)), m_Mask(kInitialCapacity - 1) {}
+
+    inline bool        Empty() const { return m_Head == m_Tail; }
+    inline std::size_t Size() const { return m_Tail - m_Head; }
+
+    /// @brief Appends a job at the back, doubling the capacity when full.
+    void PushBack(Job* job)
+    {
+        if (Size() == m_Mask + 1)
+            Grow();
+        m_Buffer[m_Tail++ & m_Mask] = job;
+    }
+
+    /// @brief Gets the oldest job without removing it. The queue must not be empty.
+    inline Job* Front() const { return m_Buffer[m_Head & m_Mask]; }
+
+    /// @brief Removes the newest job. The queue must not be empty.
+    inline Job* PopBack() { return m_Buffer[--m_Tail & m_Mask]; }
+
+    /// @brief Removes the oldest job. The queue must not be empty.
+    inline Job* PopFront() { return m_Buffer[m_Head++ & m_Mask]; }
+
+private:
+    static constexpr std::size_t kInitialCapacity = 256;
+
+    void Grow()
+    {
+        std::size_t capacity = (m_Mask + 1) * 2;
+        auto        buffer   = std::make_unique<Job*[]>(capacity);
+        for (std::size_t i = m_Head; i != m_Tail; ++i)
+            buffer[i & (capacity - 1)] = m_Buffer[i & m_Mask];
+        m_Buffer = std::move(buffer);
+        m_Mask   = capacity - 1;
+    }
+
+private:
+    std::unique_ptr<Job*[]> m_Buffer;
+    std::size_t             m_Mask;
+    std::size_t             m_Head = 0;
+    std::size_t             m_Tail = 0;
+};
+
+} // namespace Nodens
@@ -0,0 +1,158 @@
+#include "JobGraph.h"
+
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+namespace Nodens
+{
+
+JobGraph::JobGraph(JobSystem& jobSystem, const JobOptions& options) : m_JobSystem(jobSystem), m_Options(options) {}
+
+JobGraph::~JobGraph()
+{
+    Wait();
+}
+
+JobGraph::NodeId JobGraph::AddNode(std::string name, std::function<void()> work)
+{
+    ND_CORE_ASSERT(IsComplete(), "Cannot modify a JobGraph while it is running!");
+
+    Node& node = m_Nodes.emplace_back();
+    node.Name  = std::move(name);
+    node.Work  = std::move(work);
+
+    m_Dirty = true;
+    return static_cast<NodeId>(m_Nodes.size() - 1);
+}
+
+void JobGraph::AddEdge(NodeId before, NodeId after)
+{
+    ND_CORE_ASSERT(IsComplete(), "Cannot modify a JobGraph while it is running!");
+    ND_CORE_ASSERT(before < m_Nodes.size() && after < m_Nodes.size(), "Invalid JobGraph node!");
+
+    m_Nodes[before].Successors.push_back(after);
+    m_Nodes[after].PredecessorCount++;
+    m_Dirty = true;
+}
+
+void JobGraph::Clear()
+{
+    ND_CORE_ASSERT(IsComplete(), "Cannot modify a JobGraph while it is running!");
+
+    m_Nodes.clear();
+    m_Roots.clear();
+    m_Dirty = true;
+}
+
+bool JobGraph::Build()
+{
+    ZoneScoped;
+
+    m_Roots.clear();
+
+    // Kahn's algorithm: if peeling off ready nodes does not reach every node, there is a cycle.
+    std::vector<uint32_t> inDegree(m_Nodes.size());
+    std::vector<NodeId>   ready;
+    for (NodeId id = 0; id < m_Nodes.size(); ++id)
+    {
+        inDegree[id] = m_Nodes[id].PredecessorCount;
+        if (inDegree[id] == 0)
+        {
+            m_Roots.push_back(id);
+            ready.push_back(id);
+        }
+    }
+
+    std::size_t visited = 0;
+    while (!ready.empty())
+    {
+        NodeId id = ready.back();
+        ready.pop_back();
+        visited++;
+
+        for (NodeId successor : m_Nodes[id].Successors)
+        {
+            if (--inDegree[successor] == 0)
+                ready.push_back(successor);
+        }
+    }
+
+    if (visited != m_Nodes.size())
+    {
+        ND_CORE_ERROR("JobGraph contains a cycle, it will not be executed.");
+        return false;
+    }
+
+    m_Dirty = false;
+    return true;
+}
+
+bool JobGraph::Execute()
+{
+    ZoneScoped;
+
+    if (!IsComplete())
+        return false;
+
+    if (m_Dirty && !Build())
+        return false;
+
+    if (m_Nodes.empty())
+        return true;
+
+    for (Node& node : m_Nodes)
+        node.PendingPredecessors.store(node.PredecessorCount, std::memory_order_relaxed);
+
+    m_Remaining.Add(static_cast<uint32_t>(m_Nodes.size()));
+
+    // Submitting publishes the counters above to the workers.
+    for (NodeId root : m_Roots)
+        m_JobSystem.Enqueue(Job::Create([this, root]() { RunNode(root); }), m_Options);
+
+    return true;
+}
+
+void JobGraph::RunNode(NodeId id)
+{
+    while (true)
+    {
+        Node& node = m_Nodes[id];
+        {
+            ZoneScopedN("JobGraph Node");
+            ZoneName(node.Name.c_str(), node.Name.size());
+            // A cancelled graph still walks its edges, so the execution completes; only the work is skipped.
+            if (node.Work && !JobSystem::IsCancellationRequested())
+                node.Work();
+        }
+
+        // Release the successors. All but the last ready one go to the job system, the last one
+        // continues on this thread, which saves a queue round-trip along chains.
+        NodeId next    = 0;
+        bool   hasNext = false;
+        for (NodeId successor : node.Successors)
+        {
+            if (m_Nodes[successor].PendingPredecessors.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                continue;
+
+            if (hasNext)
+                m_JobSystem.Enqueue(Job::Create([this, next]() { RunNode(next); }), m_Options);
+            next    = successor;
+            hasNext = true;
+        }
+
+        // Once the counter reaches zero the owner may destroy the graph, so this is the last access to
+        // it, unless a successor is still to run here (in which case the counter cannot reach zero).
+        m_JobSystem.Signal(m_Remaining);
+        if (!hasNext)
+            return;
+        id = next;
+    }
+}
+
+void JobGraph::Wait()
+{
+    ZoneScoped;
+    m_JobSystem.Wait(m_Remaining);
+}
+
+} // namespace Nodens
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Nodens/JobSystem.h"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Nodens
+{
+
+/// @brief A reusable dependency graph of jobs executed on a JobSystem.
+/// @details Nodes and edges are declared once (per frame or per session). Each execution resets one atomic
+/// counter per node to its number of predecessors; when a node finishes it decrements the counters of its
+/// successors and schedules those that reach zero, running the last one directly on the same worker.
+/// Nothing blocks while the graph runs, and re-executing a built graph performs no heap allocation.
+///
+/// @code
+/// JobGraph graph(jobSystem);
+/// auto load    = graph.AddNode("Load", [] { ... });
+/// auto physics = graph.AddNode("Physics", [] { ... });
+/// auto audio   = graph.AddNode("Audio", [] { ... });
+/// graph.AddEdge(load, physics);
+/// graph.AddEdge(load, audio);
+/// graph.Execute(); // every frame
+/// @endcode
+class JobGraph
+{
+public:
+    using NodeId = uint32_t;
+
+    /// @brief Creates an empty graph.
+    /// @param jobSystem The job system whose workers run the nodes. Must outlive the graph.
+    /// @param options The options every node is submitted with, e.g. JobPriority::Critical for per-frame graphs.
+    /// Once options.Cancellation is stopped, executions still complete but skip the work of the remaining nodes.
+    explicit JobGraph(JobSystem& jobSystem, const JobOptions& options = {});
+
+    /// @brief Waits for a running execution before destroying the nodes.
+    /// @details Waiting goes through the job system, so the graph must not outlive it, even when idle. A graph owned
+    /// by a Layer is fine: the Application destroys its layers before its JobSystem.
+    ~JobGraph();
+
+    JobGraph(const JobGraph&)            = delete;
+    JobGraph& operator=(const JobGraph&) = delete;
+
+    /// @brief Adds a node to the graph.
+    /// @param name Debug name, used for the node's Tracy zone.
+    /// @param work The function run each time the node executes. It must not throw.
+    /// @return The handle used to declare edges.
+    NodeId AddNode(std::string name, std::function<void()> work);
+
+    /// @brief Declares that 'after' may only start once 'before' has finished.
+    void AddEdge(NodeId before, NodeId after);
+
+    /// @brief Removes all nodes and edges. The graph must not be running.
+    void Clear();
+
+    /// @brief Starts an execution of the whole graph and returns immediately.
+    /// @details Root nodes are submitted to the job system; everything else is scheduled by its predecessors.
+    /// @return False if the graph is still running or contains a cycle; nothing is started in that case.
+    bool Execute();
+
+    /// @brief Checks without blocking whether the last execution has finished.
+    inline bool IsComplete() const { return m_Remaining.IsDone(); }
+
+    /// @brief Waits for the last execution to finish, running queued jobs meanwhile (see JobSystem::Wait()).
+    void Wait();
+
+    /// @brief Gets the number of nodes in the graph.
+    inline std::size_t GetNodeCount() const { return m_Nodes.size(); }
+
+private:
+    struct Node
+    {
+        std::string           Name;
+        std::function<void()> Work;
+        std::vector<NodeId>   Successors;
+        uint32_t              PredecessorCount = 0;
+
+        /// @brief Predecessors still running in the current execution.
+        std::atomic<uint32_t> PendingPredecessors = 0;
+    };
+
+    /// @brief Runs a node and then its successors that became ready, continuing inline with the last one.
+    void RunNode(NodeId id);
+
+    /// @brief Recomputes the root list and checks the graph for cycles.
+    /// @return False if the graph contains a cycle.
+    bool Build();
+
+private:
+    JobSystem& m_JobSystem;
+    JobOptions m_Options;
+
+    /// @brief Nodes are never moved once added (std::deque), so workers can hold references.
+    std::deque<Node> m_Nodes;
+
+    /// @brief Nodes without predecessors, cached until the topology changes.
+    std::vector<NodeId> m_Roots;
+    bool                m_Dirty = true;
+
+    /// @brief Nodes of the current execution that have not finished yet.
+    JobCounter m_Remaining;
+};
+
+} // namespace Nodens
@@ -1,44 +1,221 @@
 #include "JobSystem.h"
 
+#include "BlockingPool.h"
+#include "CpuTopology.h"
+#include "Memory/ScratchArena.h"
+#include "TimerWheel.h"
 #include "ndpch.h"
 #include <tracy/Tracy.hpp>
 
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
 namespace Nodens
 {
 
-JobSystem::JobSystem()
+// Identifies the worker running on the current thread. Used to route nested submissions to the
+// local deque. The owning system is stored as well, so several JobSystems can coexist.
+static thread_local const JobSystem* t_OwnerSystem = nullptr;
+static thread_local int              t_WorkerIndex = -1;
+
+// Priority of the job running on the current thread, inherited by ParallelFor helpers.
+static thread_local JobPriority t_CurrentPriority = JobPriority::Critical;
+
+// Number of jobs running on the current thread. Above one, a helping wait runs a job inside another.
+static thread_local int t_JobDepth = 0;
+
+#ifdef TRACY_ENABLE
+static constexpr bool kProfilerEnabled = true;
+#else
+static constexpr bool kProfilerEnabled = false;
+#endif
+
+// Tracy plot names per priority. Tracy identifies plots by pointer, so these must be literals.
+static constexpr const char* kQueueDepthPlots[kJobPriorityCount] = {
+    "Jobs Pending (Critical)", "Jobs Pending (Normal)", "Jobs Pending (Background)"};
+static constexpr const char* kWaitTimePlots[kJobPriorityCount] = {
+    "Job Wait us (Critical)", "Job Wait us (Normal)", "Job Wait us (Background)"};
+
+// Spin-wait hint: lets the sibling hyper-thread run and saves power while a worker spins.
+static inline void CpuRelax()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    __asm__ __volatile__("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+// Cheap per-thread xorshift generator used to pick steal victims.
+static thread_local uint32_t t_StealSeed = 0;
+
+static uint32_t NextStealRandom()
+{
+    // Threads outside the pool (helping waiters) seed lazily from their id.
+    if (t_StealSeed == 0)
+        t_StealSeed = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+
+    uint32_t x = t_StealSeed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    t_StealSeed = x;
+    return x;
+}
+
+JobSystem::JobSystem(unsigned int threadCount) : JobSystem(JobSystemConfig{.ThreadCount = threadCount}) {}
+
+// Where the workers and the main thread run, planned from the topology and the config.
+struct ThreadLayout
+{
+    unsigned int                           ThreadCount = 0;
+    std::vector<std::vector<unsigned int>> WorkerCpus; // Empty when unpinned.
+    std::vector<unsigned int>              MainCpus;   // Empty when unpinned.
+};
+
+static ThreadLayout PlanThreadLayout(const JobSystemConfig& config, const CpuTopology& topology)
+{
+    // Group the logical CPUs into cores. The topology is sorted by cache domain, then core, so siblings are adjacent.
+    struct Core
+    {
+        unsigned int              CacheDomain;
+        std::vector<unsigned int> Cpus;
+    };
+    std::vector<Core> cores;
+    for (std::size_t i = 0; i < topology.Cpus.size(); ++i)
+    {
+        const LogicalCpu& cpu = topology.Cpus[i];
+        if (config.PreferPhysicalCores && i > 0 && topology.Cpus[i - 1].Core == cpu.Core)
+            cores.back().Cpus.push_back(cpu.Id);
+        else
+            cores.push_back({cpu.CacheDomain, {cpu.Id}});
+    }
+
+    // The main thread keeps the first cores, but at least one is left for the workers.
+    ThreadLayout layout;
+    std::size_t  reserved = std::min<std::size_t>(config.ReservedCores, cores.size() - 1);
+    for (std::size_t i = 0; i < reserved; ++i)
+        layout.MainCpus.insert(layout.MainCpus.end(), cores[i].Cpus.begin(), cores[i].Cpus.end());
+    cores.erase(cores.begin(), cores.begin() + reserved);
+
+    // Scatter: interleave the cache domains, taking the next core of each in turn.
+    if (config.Pinning == ThreadPinning::Scatter)
+    {
+        std::vector<std::vector<Core>> domains;
+        for (Core& core : cores)
+        {
+            if (domains.empty() || domains.back().front().CacheDomain != core.CacheDomain)
+                domains.emplace_back();
+            domains.back().push_back(std::move(core));
+        }
+        cores.clear();
+        for (std::size_t round = 0;; ++round)
+        {
+            std::size_t before = cores.size();
+            for (auto& domain : domains)
+            {
+                if (round < domain.size())
+                    cores.push_back(std::move(domain[round]));
+            }
+            if (cores.size() == before)
+                break;
+        }
+    }
+
+    layout.ThreadCount = config.ThreadCount != 0 ? config.ThreadCount : static_cast<unsigned int>(cores.size());
+    if (config.Pinning == ThreadPinning::None)
+    {
+        layout.MainCpus.clear();
+        return layout;
+    }
+
+    // A physical core pins its worker to the first sibling; the other siblings stay unused.
+    for (unsigned int i = 0; i < layout.ThreadCount; ++i)
+        layout.WorkerCpus.push_back({cores[i % cores.size()].Cpus.front()});
+    return layout;
+}
+
+JobSystem::JobSystem(const JobSystemConfig& config) : m_Config(config)
 {
-    // Calculate how many threads to spawn. We generally want to match the CPU
-    // cores but leave one core free for the main thread to prevent hitching.
-    unsigned int threadCount = std::thread::hardware_concurrency();
-    if (threadCount > 1)
-        threadCount--;
+    // Plan the workers around the machine's cores, leaving the reserved ones free for the main thread to
+    // prevent hitching.
+    const CpuTopology  topology    = CpuTopology::Detect();
+    const ThreadLayout layout      = PlanThreadLayout(config, topology);
+    const unsigned int threadCount = layout.ThreadCount;
+
+    m_BlockingPool = std::make_unique<BlockingPool>(kMaxBlockingThreads, kBlockingIdleTimeout, config.EnableTelemetry);
+    m_TimerWheel   = std::make_unique<TimerWheel>(*this);
+
+    // All deques must exist before any worker starts, since workers steal from each other.
+    m_Workers.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        m_Workers.emplace_back(std::make_unique<Worker>());
 
     m_Threads.reserve(threadCount);
 
     // Launch the workers.
     for (unsigned int i = 0; i < threadCount; ++i)
     {
+        std::vector<unsigned int> cpus;
+        if (!layout.WorkerCpus.empty())
+            cpus = layout.WorkerCpus[i];
+
         // std::jthread automatically passes a stop_token as the first argument
         // to the thread function if the signature accepts it.
         m_Threads.emplace_back(
-            [this, i](std::stop_token stoken)
+            [this, i, cpus = std::move(cpus)](std::stop_token stoken)
             {
                 // Profiler hook: Give the thread a name so we can see it when
                 // using Tracy.
-                std::string name = "Worker " + std::to_string(i);
+                std::string name = "Compute Worker " + std::to_string(i);
                 tracy::SetThreadName(name.c_str());
 
-                this->WorkerLoop(stoken);
+                if (!PinCurrentThread(cpus))
+                    ND_CORE_WARN("Could not pin {0} to CPU {1}.", name, FormatCpuList(cpus));
+
+                t_OwnerSystem = this;
+                t_WorkerIndex = static_cast<int>(i);
+                t_StealSeed   = 0x9E3779B9u * (i + 1);
+
+                this->WorkerLoop(stoken, i);
             });
     }
 
-    ND_CORE_INFO("JobSystem initialized with {0} worker threads.", threadCount);
+    // The JobSystem is created by the main thread, so it can pin it right away.
+    if (!PinCurrentThread(layout.MainCpus))
+        ND_CORE_WARN("Could not pin the main thread to CPUs {0}.", FormatCpuList(layout.MainCpus));
+
+    ND_CORE_INFO("JobSystem initialized with {0} compute workers and up to {1} blocking threads.", threadCount,
+                 m_BlockingPool->GetMaxThreadCount());
+    ND_CORE_INFO("  CPU topology: {0}.", topology.Describe());
+    if (layout.WorkerCpus.empty())
+    {
+        ND_CORE_INFO("  Workers are not pinned.");
+    }
+    else
+    {
+        std::string workers;
+        for (unsigned int i = 0; i < threadCount; ++i)
+            workers += (i == 0 ? "" : ", ") + std::to_string(i) + "->" + FormatCpuList(layout.WorkerCpus[i]);
+        const char* policy = config.Pinning == ThreadPinning::Compact ? "Compact" : "Scatter";
+        ND_CORE_INFO("  {0} pinning, worker->CPU: {1}.", policy, workers);
+        ND_CORE_INFO("  Main thread CPUs: {0}.", FormatCpuList(layout.MainCpus));
+    }
 }
 
 JobSystem::~JobSystem()
 {
     // SHUTDOWN SEQUENCE
+    // Timers submit into the queues, so they stop before anything else. Pending ones are discarded.
+    m_TimerWheel.reset();
+
     // Ask all threads to stop. Ideally, they finish their current task and then
     // see this.
     for (auto& thread : m_Threads)
@@ -51,59 +228,428 @@ JobSystem::~JobSystem()
     // wake, check the token, and exit.
     m_Condition.notify_all();
 
-    // Because they are std::jthread, they will automatically perform a .join()
-    // waiting for the threads to actually finish execution before this object
-    // dies.
+    // Join now rather than on member destruction, the queues below must not be touched by
+    // any worker anymore.
+    m_Threads.clear();
+
+    // Blocking jobs may still signal counters or submit compute jobs (which are discarded below), so the pool
+    // goes before the queues and the sleep state. It is shut down before it is destroyed: jobs finishing during
+    // the shutdown may still submit through m_BlockingPool, which reset() clears before deleting.
+    m_BlockingPool->Shutdown();
+    m_BlockingPool.reset();
+
+    // Release whatever never got to run, so the callables (and their captures) are destroyed.
+    for (std::size_t level = 0; level < kJobPriorityCount; ++level)
+    {
+        for (auto& worker : m_Workers)
+        {
+            while (!worker->Jobs[level].Empty())
+                worker->Jobs[level].PopFront()->Discard();
+        }
+        while (!m_InjectionQueues[level].Empty())
+            m_InjectionQueues[level].PopFront()->Discard();
+    }
+}
+
+int JobSystem::GetCurrentWorkerIndex() const
+{
+    return t_OwnerSystem == this ? t_WorkerIndex : -1;
+}
+
+TimerHandle JobSystem::ScheduleTimer(Job* job, const JobOptions& options, std::chrono::steady_clock::duration delay)
+{
+    return m_TimerWheel->Schedule(job, options, delay);
+}
+
+TimerHandle JobSystem::ScheduleRepeatingTimer(std::function<void()> callback, const JobOptions& options,
+                                              std::chrono::steady_clock::duration period)
+{
+    return m_TimerWheel->ScheduleEvery(std::move(callback), options, period);
+}
+
+bool JobSystem::CancelTimer(TimerHandle handle)
+{
+    return m_TimerWheel->Cancel(handle);
+}
+
+unsigned int JobSystem::GetBlockingThreadCount() const
+{
+    return m_BlockingPool->GetThreadCount();
+}
+
+JobPriority JobSystem::GetRangePriority() const
+{
+    return GetCurrentWorkerIndex() >= 0 ? t_CurrentPriority : JobPriority::Critical;
+}
+
+void JobSystem::Enqueue(Job* job, const JobOptions& options)
+{
+    EnqueueBatch(std::span<Job* const>(&job, 1), options);
+}
+
+void JobSystem::EnqueueBatch(std::span<Job* const> jobs, const JobOptions& options)
+{
+    if (jobs.empty())
+        return;
+
+    const JobPriority priority = options.Priority;
+    const auto        level    = static_cast<std::size_t>(priority);
+    // The timestamp only feeds the wait times, so the clock is not read without telemetry or the profiler.
+    const int64_t now = m_Config.EnableTelemetry || kProfilerEnabled ? NowNanoseconds() : 0;
+    for (Job* job : jobs)
+    {
+        job->MarkQueued(priority, now);
+        if (options.Cancellation.stop_possible())
+            job->SetStopToken(options.Cancellation);
+    }
+
+    // Blocking jobs never touch the compute queues or the pending counters the workers sleep on.
+    if (options.Pool == WorkerPool::Blocking)
+    {
+        m_BlockingPool->Push(jobs, priority);
+        return;
+    }
+
+    int index = GetCurrentWorkerIndex();
+    if (index >= 0)
+    {
+        // Nested submission: keep the jobs on this worker, they are likely to touch the same data.
+        // Idle workers steal them from here.
+        Worker& worker = *m_Workers[index];
+        std::scoped_lock lock(worker.Mutex);
+        for (Job* job : jobs)
+            worker.Jobs[level].PushBack(job);
+    }
+    else
+    {
+        // Lock the injection queue to safely add the new jobs
+        std::scoped_lock lock(m_QueueMutex);
+        for (Job* job : jobs)
+            m_InjectionQueues[level].PushBack(job);
+    }
+
+    // The per-priority count goes first: a thread that sees the total go up also sees which queue has work.
+    const auto                     count = static_cast<int64_t>(jobs.size());
+    [[maybe_unused]] const int64_t pendingAtLevel =
+        m_PendingByPriority[level].fetch_add(count, std::memory_order_relaxed) + count;
+    [[maybe_unused]] const int64_t pending = m_PendingJobs.fetch_add(count) + count;
+    TracyPlot("Job Queue Size", pending);
+    TracyPlot(kQueueDepthPlots[level], pendingAtLevel);
+
+    // Awake (busy or spinning) workers will find the jobs on their own, so the wake-up is only paid for when
+    // someone actually sleeps. Pairs with the increments in WorkerLoop() and Wait(): either we see the thread
+    // asleep, or it sees the jobs before parking. Threads sleeping in Wait() count too: they may be the workers
+    // themselves, helping while they wait on the very jobs submitted here from outside the pool.
+    const uint32_t sleeping = m_SleepingWorkers.load();
+    const uint32_t waiting  = m_SleepingWaiters.load();
+    if (sleeping + waiting == 0)
+        return;
+
+    // Taking the sleep mutex orders this submission against a thread that has just checked the
+    // predicate and is about to park, so the notifications below cannot be lost.
+    {
+        std::scoped_lock lock(m_SleepMutex);
+    }
+
+    // Wake one sleeping worker per job, all of them at once if there are at least as many jobs. Waiters share
+    // the condition variable, so with any of them asleep notify_one() might wake a waiter in place of a worker.
+    if (waiting > 0 || jobs.size() >= sleeping)
+    {
+        m_Condition.notify_all();
+    }
+    else
+    {
+        for (std::size_t i = 0; i < jobs.size(); ++i)
+            m_Condition.notify_one();
+    }
+}
+
+Job* JobSystem::TryAcquire(int index)
+{
+    Worker* worker = index >= 0 ? m_Workers[index].get() : nullptr;
+
+    std::size_t starved = 0;
+    if (ClaimStarvedLevel(starved))
+    {
+        if (Job* job = TryAcquireFrom(worker, index, starved, true))
+            return job;
+    }
+
+    for (std::size_t level = 0; level < kJobPriorityCount; ++level)
+    {
+        if (m_PendingByPriority[level].load(std::memory_order_relaxed) <= 0)
+            continue;
+
+        if (Job* job = TryAcquireFrom(worker, index, level, false))
+            return job;
+    }
+    return nullptr;
+}
+
+Job* JobSystem::TryAcquireFrom(Worker* worker, int index, std::size_t level, bool oldestFirst)
+{
+    // 1. Own deque, newest first (hot caches) unless the oldest job is wanted.
+    if (worker)
+    {
+        JobQueue&        jobs = worker->Jobs[level];
+        std::scoped_lock lock(worker->Mutex);
+        if (!jobs.Empty())
+            return oldestFirst ? jobs.PopFront() : jobs.PopBack();
+    }
+
+    // 2. Injection queue, oldest first.
+    {
+        std::scoped_lock lock(m_QueueMutex);
+        if (!m_InjectionQueues[level].Empty())
+        {
+            // Mark that this thread is currently holding the lock (Optional, for high contention debug)
+            LockMark(m_QueueMutex);
+            return m_InjectionQueues[level].PopFront();
+        }
+    }
+
+    // 3. Someone else's deque.
+    return TrySteal(index, level);
 }
 
-void JobSystem::WorkerLoop(std::stop_token stoken)
+bool JobSystem::ClaimStarvedLevel(std::size_t& level)
 {
+    // Only relevant while a higher priority has work too, so the common case costs two relaxed loads.
+    int64_t now           = 0;
+    bool    higherHasWork = m_PendingByPriority[0].load(std::memory_order_relaxed) > 0;
+    for (std::size_t candidate = 1; candidate < kJobPriorityCount; ++candidate)
+    {
+        const bool hasWork = m_PendingByPriority[candidate].load(std::memory_order_relaxed) > 0;
+        if (higherHasWork && hasWork)
+        {
+            if (now == 0)
+                now = NowNanoseconds();
+
+            // The exchange lets exactly one thread serve the starved priority per period.
+            int64_t last = m_LastStarvedServe[candidate].load(std::memory_order_relaxed);
+            if (now - last > kStarvationLimitNs &&
+                m_LastStarvedServe[candidate].compare_exchange_strong(last, now, std::memory_order_relaxed))
+            {
+                level = candidate;
+                return true;
+            }
+        }
+        higherHasWork = higherHasWork || hasWork;
+    }
+    return false;
+}
+
+Job* JobSystem::TrySteal(int thief, std::size_t level)
+{
+    const unsigned int count = static_cast<unsigned int>(m_Workers.size());
+    if (count == 0)
+        return nullptr;
+
+    // Start at a random victim and sweep once, so contention spreads across deques.
+    const unsigned int start = NextStealRandom() % count;
+    for (unsigned int n = 0; n < count; ++n)
+    {
+        unsigned int victimIndex = (start + n) % count;
+        if (static_cast<int>(victimIndex) == thief)
+            continue;
+
+        Worker& victim = *m_Workers[victimIndex];
+
+        // Never wait on a busy victim, just move on to the next one.
+        std::unique_lock lock(victim.Mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.Jobs[level].Empty())
+            continue;
+
+        GetCounters(thief).RecordSteal();
+        return victim.Jobs[level].PopFront();
+    }
+    return nullptr;
+}
+
+void JobSystem::WorkerLoop(std::stop_token stoken, unsigned int index)
+{
+    JobCounters&  counters = m_Workers[index]->Counters;
+    ScratchArena& scratch  = ScratchArena::Get();
+
     // The main loop for each worker thread. It continues as long as no stop is requested.
     while (!stoken.stop_requested())
     {
-        // This will hold the task to be executed.
-        std::move_only_function<void()> task;
+        // This will hold the job to be executed.
+        Job* job = TryAcquire(static_cast<int>(index));
+        if (job)
+        {
+            // Scratch memory is job-scoped on the workers, so it is released as soon as the job is done.
+            RunJob(job);
+            scratch.Reset();
+            continue;
+        }
+
+        // Idle until a job shows up or the worker wakes from parking. The clock is only read on this path, a busy
+        // worker goes straight from one job to the next.
+        const int64_t idleStart = m_Config.EnableTelemetry ? NowNanoseconds() : 0;
+
+        job = SpinForJob(stoken, index);
+        if (!job)
         {
-            // Lock the queue to safely access it.
-            std::unique_lock lock(m_QueueMutex);
+            std::unique_lock lock(m_SleepMutex);
+            counters.RecordPark();
 
             // Wait on the condition variable. The thread will sleep until a new task is added
-            // or a stop is requested. The lambda is a predicate that checks if the queue is not empty.
-            // The wait will only proceed if the predicate is true or if a stop is requested.
-            bool tasksAvailable = m_Condition.wait(lock, stoken, [this] { return !m_Tasks.empty(); });
+            // or a stop is requested. A failed sweep (e.g. a victim was locked) with pending work
+            // returns immediately and simply tries again.
+            [[maybe_unused]] uint32_t sleeping = m_SleepingWorkers.fetch_add(1) + 1;
+            TracyPlot("Sleeping Workers", static_cast<int64_t>(sleeping));
+            bool tasksAvailable = m_Condition.wait(lock, stoken, [this] { return m_PendingJobs.load() > 0; });
+            sleeping            = m_SleepingWorkers.fetch_sub(1) - 1;
+            TracyPlot("Sleeping Workers", static_cast<int64_t>(sleeping));
 
             // If wait returns because a stop was requested and there are no tasks, exit the loop.
             if (!tasksAvailable && stoken.stop_requested())
             {
                 return;
             }
+            counters.RecordWakeUp();
+        }
 
-            // Although the predicate should protect against this, a double check ensures thread safety
-            // in case of spurious wakeups.
-            if (m_Tasks.empty())
-            {
-                continue;
-            }
+        if (m_Config.EnableTelemetry)
+            counters.RecordIdle(NowNanoseconds() - idleStart);
 
-            // A task is available, so move it from the queue to the local 'task' variable.
-            task = std::move(m_Tasks.front());
-            m_Tasks.pop();
+        if (job)
+        {
+            RunJob(job);
+            scratch.Reset();
+        }
+    }
+}
 
-            // Visualize queue size decreasing
-            TracyPlot("Job Queue Size", (int64_t)m_Tasks.size());
+Job* JobSystem::SpinForJob(const std::stop_token& stoken, unsigned int index)
+{
+    if (m_Config.SpinTime.count() <= 0 && m_Config.YieldTime.count() <= 0)
+        return nullptr;
 
-            // Mark that this thread is currently holding the lock (Optional, for high contention debug)
-            LockMark(m_QueueMutex);
+    const auto spinEnd  = std::chrono::steady_clock::now() + m_Config.SpinTime;
+    const auto yieldEnd = spinEnd + m_Config.YieldTime;
+    while (!stoken.stop_requested())
+    {
+        // The pending count is a plain load, so spinning never touches the queue locks while idle.
+        if (m_PendingJobs.load(std::memory_order_relaxed) > 0)
+        {
+            if (Job* job = TryAcquire(static_cast<int>(index)))
+                return job;
         }
 
-        // Execute the task outside the lock to avoid holding the lock unnecessarily
-        // and to allow other threads to queue up tasks.
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= yieldEnd)
+            break;
+
+        if (now < spinEnd)
         {
-            ZoneScoped;
-            if (task)
-                task();
+            for (int i = 0; i < kPausesPerSpinCheck; ++i)
+                CpuRelax();
         }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::RunJob(Job* job)
+{
+    const JobPriority priority = job->GetPriority();
+    const auto        level    = static_cast<std::size_t>(priority);
+
+    // Visualize queue size decreasing
+    [[maybe_unused]] const int64_t pendingAtLevel =
+        m_PendingByPriority[level].fetch_sub(1, std::memory_order_relaxed) - 1;
+    [[maybe_unused]] const int64_t pending = m_PendingJobs.fetch_sub(1) - 1;
+    TracyPlot("Job Queue Size", pending);
+    TracyPlot(kQueueDepthPlots[level], pendingAtLevel);
+
+    // Without telemetry only the count is recorded, the clock is not read.
+    const bool    timed     = m_Config.EnableTelemetry;
+    const int64_t start     = timed || kProfilerEnabled ? NowNanoseconds() : 0;
+    const int64_t waitTime  = timed ? start - job->GetEnqueueTime() : -1;
+    const bool    outermost = t_JobDepth++ == 0;
+    TracyPlot(kWaitTimePlots[level], (start - job->GetEnqueueTime()) / 1000);
+
+    // Execute the job outside any lock to avoid holding it unnecessarily
+    // and to allow other threads to queue up jobs. Running also recycles the slot.
+    // Helping waits nest jobs on one thread, so the previous priority is restored afterwards.
+    {
+        ZoneScoped;
+        const JobPriority previous = std::exchange(t_CurrentPriority, priority);
+        job->Run();
+        t_CurrentPriority = previous;
+    }
+
+    t_JobDepth--;
+    GetCounters(GetCurrentWorkerIndex()).RecordJob(waitTime, timed ? NowNanoseconds() - start : -1, outermost);
+}
+
+JobCounters& JobSystem::GetCounters(int index)
+{
+    return index >= 0 ? m_Workers[index]->Counters : m_HelperCounters;
+}
+
+JobSystemStats JobSystem::GetStats() const
+{
+    JobSystemStats stats;
+    stats.Timestamp = std::chrono::steady_clock::now();
+    stats.Workers.reserve(m_Workers.size());
+    for (const auto& worker : m_Workers)
+        stats.Workers.push_back(worker->Counters.Snapshot());
+    stats.Helpers  = m_HelperCounters.Snapshot();
+    stats.Blocking = m_BlockingPool->GetStats();
+    return stats;
+}
+
+bool JobSystem::RunPendingJob()
+{
+    Job* job = TryAcquire(GetCurrentWorkerIndex());
+    if (!job)
+        return false;
+
+    RunJob(job);
+    return true;
+}
+
+void JobSystem::Signal(JobCounter& counter, uint32_t count)
+{
+    // After this decrement the counter may already be destroyed by its waiter, so only
+    // the JobSystem is touched from here on.
+    if (counter.m_Pending.fetch_sub(count) != count)
+        return;
+
+    // Pairs with the increment in Wait(): either the waiter sees the counter done before it
+    // sleeps, or we see it asleep and wake it.
+    if (m_SleepingWaiters.load() > 0)
+    {
+        {
+            std::scoped_lock lock(m_SleepMutex);
+        }
+        m_Condition.notify_all();
+    }
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+    ZoneScoped;
+
+    while (!counter.IsDone())
+    {
+        // Help: run whatever is queued, it may well be the job we are waiting for.
+        if (RunPendingJob())
+            continue;
+
+        // Nothing to help with, our jobs are running elsewhere. Sleep until one of them
+        // completes the counter or new work shows up.
+        std::unique_lock lock(m_SleepMutex);
+        m_SleepingWaiters.fetch_add(1);
+        m_Condition.wait(lock, [&] { return counter.m_Pending.load() == 0 || m_PendingJobs.load() > 0; });
+        m_SleepingWaiters.fetch_sub(1);
     }
 }
 
-} // namespace Nodens
\ No newline at end of file
+} // namespace Nodens
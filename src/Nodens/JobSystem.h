@@ -1,86 +1,997 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
 #include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
 #include <stop_token>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 #include <tracy/Tracy.hpp>
 
+#include "Nodens/Job.h"
+#include "Nodens/JobTelemetry.h"
+
 namespace Nodens
 {
 
-/// @brief A multithreaded job system utilizing C++20 jthreads for automatic joining and cancellation.
-/// @details This system manages a pool of worker threads that consume tasks from a shared queue.
-/// It uses a 'future-based' approach for task submission.
+class JobSystem;
+
+/// @brief A lightweight completion primitive: the number of jobs of a group that have not finished yet.
+/// @details Cheaper than a std::future (a single atomic, no shared state, no allocation) and meant to be waited on
+/// with JobSystem::Wait(), which runs queued jobs while the counter is not done. Counters are signalled by the
+/// JobSystem, which also wakes the waiters, so a counter may be destroyed as soon as Wait() returns.
+class JobCounter
+{
+public:
+    JobCounter() = default;
+
+    /// @brief Creates a counter that expects 'pending' signals.
+    explicit JobCounter(uint32_t pending) : m_Pending(pending) {}
+
+    JobCounter(const JobCounter&)            = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    /// @brief Expects 'count' more signals. Must happen before the jobs that signal them are submitted.
+    inline void Add(uint32_t count = 1) { m_Pending.fetch_add(count, std::memory_order_relaxed); }
+
+    /// @brief Checks without blocking whether every expected signal has arrived.
+    /// @details Everything the signalling jobs wrote is visible to the caller once this returns true.
+    inline bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+    /// @brief Gets the number of signals still expected.
+    inline uint32_t GetPending() const { return m_Pending.load(std::memory_order_relaxed); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_Pending = 0;
+};
+
+/// @brief Thrown by JobHandle::Get() when the job's cancellation group was cancelled before it ran.
+class JobCancelledError : public std::runtime_error
+{
+public:
+    JobCancelledError() : std::runtime_error("The job was cancelled before it ran.") {}
+};
+
+/// @brief A handle to the result of a job started with JobSystem::Spawn().
+/// @details Unlike std::future::get(), Wait() and Get() run other queued jobs while the result is not ready,
+/// so nested waits inside jobs cannot starve the pool.
+/// @tparam T The result type of the job.
+template <class T> class JobHandle
+{
+public:
+    JobHandle() = default;
+
+    /// @brief Returns true if the handle refers to a job.
+    inline bool IsValid() const { return m_State != nullptr; }
+
+    /// @brief Checks without blocking whether the job has finished.
+    inline bool IsReady() const { return m_State && m_State->Counter.IsDone(); }
+
+    /// @brief Runs queued jobs on the calling thread until this job has finished.
+    void Wait() const;
+
+    /// @brief Waits for the job, then returns its result or rethrows its exception.
+    /// @details May be called more than once; the result is returned by reference.
+    decltype(auto) Get() const;
+
+private:
+    friend class JobSystem;
+
+    struct State
+    {
+        JobCounter                                                      Counter{1};
+        std::optional<std::conditional_t<std::is_void_v<T>, bool, T>> Result;
+        std::exception_ptr                                              Exception;
+    };
+
+    JobHandle(JobSystem* system, std::shared_ptr<State> state) : m_System(system), m_State(std::move(state)) {}
+
+    JobSystem*             m_System = nullptr;
+    std::shared_ptr<State> m_State;
+};
+
+/// @brief A handle to the jobs of a batch started with JobSystem::SubmitBatch(), waited on as a whole.
+/// @details Like JobHandle, Wait() runs other queued jobs while the batch is not done. The handle may be dropped
+/// early; the jobs keep the shared counter alive until they have all run.
+class JobGroup
+{
+public:
+    JobGroup() = default;
+
+    /// @brief Returns true if the handle refers to a batch.
+    inline bool IsValid() const { return m_Counter != nullptr; }
+
+    /// @brief Checks without blocking whether every job of the batch has finished.
+    inline bool IsDone() const { return m_Counter && m_Counter->IsDone(); }
+
+    /// @brief Gets the number of jobs of the batch that have not finished yet.
+    inline uint32_t GetPending() const { return m_Counter ? m_Counter->GetPending() : 0; }
+
+    /// @brief Runs queued jobs on the calling thread until every job of the batch has finished.
+    void Wait() const;
+
+private:
+    friend class JobSystem;
+
+    JobGroup(JobSystem* system, std::shared_ptr<JobCounter> counter) : m_System(system), m_Counter(std::move(counter))
+    {
+    }
+
+    JobSystem*                  m_System = nullptr;
+    std::shared_ptr<JobCounter> m_Counter;
+};
+
+/// @brief Identifies a timer started with JobSystem::SubmitAfter() or SubmitEvery(), to cancel it.
+/// @details Carries the generation of the timer's slot, so a handle kept after the timer fired cannot cancel an
+/// unrelated timer that reuses the slot.
+struct TimerHandle
+{
+    uint32_t Index      = 0;
+    uint32_t Generation = 0;
+
+    /// @brief Returns true if the handle was returned by a timer submission.
+    inline bool IsValid() const { return Generation != 0; }
+};
+
+class BlockingPool;
+class TimerWheel;
+
+/// @brief The thread pools a job can run on.
+enum class WorkerPool : uint8_t
+{
+    /// @brief Fixed pool sized to the cores, for work that keeps the CPU busy. Jobs must not block here.
+    Compute = 0,
+
+    /// @brief Elastic pool for jobs that sleep or wait on I/O. Threads are added on demand and retire when idle.
+    Blocking,
+};
+
+/// @brief A set of jobs that can be cancelled together, e.g. the work of a request a newer one superseded.
+/// @details Submit the jobs with JobOptions::Cancellation = group.GetToken(). Once the group is cancelled, its
+/// queued jobs are dropped when a worker picks them up: their callables are destroyed without running, counters
+/// are still signalled, JobHandle::Get() throws JobCancelledError and Submit() futures report a broken promise.
+/// Running jobs are not interrupted, but can poll JobSystem::IsCancellationRequested() and return early.
+/// Copies refer to the same group.
+class CancellationGroup
+{
+public:
+    /// @brief Creates a group that is not cancelled.
+    CancellationGroup() = default;
+
+    /// @brief Cancels every job submitted with this group's token, queued or running.
+    inline void Cancel() { m_Source.request_stop(); }
+
+    /// @brief Cancels the jobs submitted so far and starts a fresh group for the next ones (in this object only;
+    /// other copies keep referring to the cancelled group).
+    inline void Reset()
+    {
+        m_Source.request_stop();
+        m_Source = std::stop_source();
+    }
+
+    /// @brief Checks whether the group has been cancelled.
+    inline bool IsCancelled() const { return m_Source.stop_requested(); }
+
+    /// @brief Gets the token to submit jobs of this group with.
+    inline std::stop_token GetToken() const { return m_Source.get_token(); }
+
+private:
+    std::stop_source m_Source;
+};
+
+/// @brief Per-submission settings of a job.
+struct JobOptions
+{
+    /// @brief The queue the job goes to. Higher priorities are served first, but while they have work each lower
+    /// priority still gets one job through per JobSystem::kStarvationLimitNs.
+    JobPriority Priority = JobPriority::Normal;
+
+    /// @brief The pool that runs the job. Anything that blocks (sleep_for, file or network I/O) belongs in
+    /// WorkerPool::Blocking, where it cannot take a compute worker away from the frame.
+    WorkerPool Pool = WorkerPool::Compute;
+
+    /// @brief Drops the job if this token is stopped before the job runs (see CancellationGroup). Any stop_token
+    /// works, e.g. the one of a std::jthread. Empty by default, which never cancels.
+    std::stop_token Cancellation;
+};
+
+/// @brief How compute workers are placed on the CPUs (see JobSystemConfig).
+enum class ThreadPinning : uint8_t
+{
+    /// @brief Workers are not pinned; the OS scheduler moves them freely.
+    None,
+
+    /// @brief Workers fill one last-level cache (L3) domain before moving to the next. Best when jobs share data.
+    Compact,
+
+    /// @brief Workers are spread round-robin over the L3 domains. Best for independent, memory-bound jobs.
+    Scatter,
+};
+
+/// @brief Start-up settings of a JobSystem.
+/// @details Worker placement is planned on the detected CpuTopology. Here a "core" is a logical CPU, or a physical
+/// core when PreferPhysicalCores is set. The first ReservedCores cores (in cache-domain order) are kept for the
+/// main thread, the workers get one core each from the rest.
+struct JobSystemConfig
+{
+    /// @brief The number of compute workers to spawn. When 0, one worker per core not reserved for the main thread.
+    /// @details With the defaults that is hardware_concurrency - 1. Larger counts than cores wrap around.
+    unsigned int ThreadCount = 0;
+
+    /// @brief How workers are pinned to cores.
+    ThreadPinning Pinning = ThreadPinning::None;
+
+    /// @brief The number of cores left to the main thread (and the OS). With pinning, the main thread is pinned to
+    /// them as well.
+    unsigned int ReservedCores = 1;
+
+    /// @brief Plan one worker per physical core instead of one per logical CPU, leaving SMT siblings unused.
+    /// @details Avoids two workers competing for the execution units of one core, at the cost of fewer workers.
+    bool PreferPhysicalCores = false;
+
+    /// @brief How long an idle worker busy-spins (with a CPU pause hint) before it starts yielding.
+    /// @details Spinning hides the several microseconds a sleeping thread needs to wake up, at the price of
+    /// CPU time. Set both idle times to zero to park idle workers immediately (lowest CPU usage).
+    std::chrono::microseconds SpinTime{25};
+
+    /// @brief How long an idle worker keeps yielding its time slice after spinning, before it parks.
+    std::chrono::microseconds YieldTime{100};
+
+    /// @brief Measure the busy and idle time of the workers and the wait and execution time of every job (see
+    /// JobSystem::GetStats()). Costs two clock reads per job. When false, only the counts are kept.
+    bool EnableTelemetry = true;
+};
+
+/// @brief A range of callables taking no arguments, one job each for JobSystem::SubmitBatch().
+template <class R>
+concept JobRange =
+    std::ranges::input_range<R> && std::invocable<std::decay_t<std::ranges::range_reference_t<R>>>;
+
+/// @brief A multithreaded work-stealing job system utilizing C++20 jthreads for automatic joining and cancellation.
+/// @details Every worker owns a local deque. Jobs submitted from inside a worker are pushed to the back of that
+/// worker's deque and popped LIFO by the owner (hot caches), while idle workers steal FIFO from the front of a
+/// randomly chosen victim. Jobs submitted from any other thread go to a shared injection queue.
+/// Each of these queues exists once per JobPriority, so frame-critical jobs never wait behind a burst of
+/// background work (see JobOptions).
+/// Jobs live in pooled, cache-line-aligned slots (see Nodens::Job), so SubmitDetached() does not allocate
+/// once the pool is warm. Submit() adds a 'future-based' result channel on top of that.
+/// Next to these compute workers the system owns an elastic BlockingPool for jobs that block (see WorkerPool).
+/// Delayed and periodic jobs wait in a TimerWheel instead of on a sleeping thread (see SubmitAfter()).
+/// An idle worker spins, then yields, then parks (see JobSystemConfig); submitting only pays for a wake-up
+/// when a worker is actually parked.
+/// Every worker keeps its own telemetry counters, readable at any time with GetStats(), with or without Tracy.
 class JobSystem
 {
 public:
-    /// @brief Initializes the JobSystem and launches worker threads.
-    /// @details The number of threads spawned is equal to hardware_concurrency - 1
-    /// to leave the main thread free for the OS/Application loop.
-    JobSystem();
+    /// @brief Initializes the JobSystem and launches the compute worker threads.
+    /// @details The blocking pool starts empty and grows on demand.
+    /// @param config The start-up settings.
+    explicit JobSystem(const JobSystemConfig& config);
+
+    /// @brief Initializes the JobSystem with default settings and the given number of compute workers.
+    /// @param threadCount The number of compute workers to spawn. When 0, hardware_concurrency - 1
+    /// threads are spawned to leave the main thread free for the OS/Application loop.
+    explicit JobSystem(unsigned int threadCount = 0);
 
     /// @brief Destructor.
     /// @details Signals all threads to stop, wakes them up, and waits for them to join.
-    /// Due to std::jthread, the joining happens automatically, but we explicitly signal stop first.
+    /// Jobs still queued at that point, and timers that have not fired, are discarded without running; their
+    /// futures report a broken promise.
     ~JobSystem();
 
+    JobSystem(const JobSystem&)            = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
     /// @brief Submits a function (job) to the execution queue.
+    /// @details When called from one of this system's workers the job goes to that worker's local deque,
+    /// otherwise it goes to the injection queue.
     /// @tparam F The type of the function object.
     /// @tparam Args The types of the arguments to pass to the function.
     /// @param f The function to execute.
     /// @param args The arguments to forward to the function.
     /// @return A std::future containing the result of the function execution.
+    /// @note The future's shared state lives on the heap. Prefer SubmitDetached() when no result is needed.
     template <class F, class... Args>
+        requires std::invocable<F, Args...>
     auto Submit(F&& f, Args&&... args) -> std::future<typename std::invoke_result<F, Args...>::type>
+    {
+        return Submit(JobOptions{}, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /// @brief Submits a function (job) with explicit options (e.g. its priority). See Submit().
+    template <class F, class... Args>
+        requires std::invocable<F, Args...>
+    auto Submit(const JobOptions& options, F&& f, Args&&... args)
+        -> std::future<typename std::invoke_result<F, Args...>::type>
     {
         // Determine the return type of the submitted function F
         using return_type = typename std::invoke_result<F, Args...>::type;
 
-        // Wrap the task in a packaged_task so we can get a future back.
-        // 'std::bind' creates a callable object that binds the arguments to the function.
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+        // Wrap the task in a packaged_task so we can get a future back. The packaged_task itself is
+        // stored inline in the job slot; only the future's shared state lives on the heap.
+        std::packaged_task<return_type()> task(
+            [f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable -> return_type
+            { return std::invoke(std::move(f), std::move(args)...); });
+
+        // A cancelled job destroys the task unrun, so the future reports a broken promise.
+        std::future<return_type> res = task.get_future();
+        Enqueue(Job::Create(
+                    [task = std::move(task)]() mutable
+                    {
+                        if (!IsCancellationRequested())
+                            task();
+                    }),
+                options);
+        return res;
+    }
+
+    /// @brief Submits a function (job) without any way to observe its completion (fire-and-forget).
+    /// @details The callable and its arguments are stored inline in a pooled job slot, so this path performs no
+    /// heap allocation as long as they fit Job::kInlineCapacity.
+    /// @tparam F The type of the function object.
+    /// @tparam Args The types of the arguments to pass to the function.
+    /// @param f The function to execute. Its return value is discarded.
+    /// @param args The arguments to forward to the function.
+    template <class F, class... Args>
+        requires std::invocable<F, Args...>
+    void SubmitDetached(F&& f, Args&&... args)
+    {
+        SubmitDetached(JobOptions{}, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /// @brief Submits a fire-and-forget function (job) with explicit options. See SubmitDetached().
+    template <class F, class... Args>
+        requires std::invocable<F, Args...>
+    void SubmitDetached(const JobOptions& options, F&& f, Args&&... args)
+    {
+        Enqueue(Job::Create(
+                    [f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable
+                    {
+                        if (!IsCancellationRequested())
+                            std::invoke(std::move(f), std::move(args)...);
+                    }),
+                options);
+    }
+
+    /// @brief Submits a function (job) that signals 'counter' once it has run.
+    /// @details Allocation-free like the fire-and-forget overload. Each call adds one expected signal to the
+    /// counter, so wait for the group with Wait(counter) only after all of its jobs have been submitted.
+    /// @param counter The counter to signal. Must outlive the job.
+    /// @param f The function to execute. Its return value is discarded.
+    /// @param args The arguments to forward to the function.
+    template <class F, class... Args>
+        requires std::invocable<F, Args...>
+    void SubmitDetached(JobCounter& counter, F&& f, Args&&... args)
+    {
+        SubmitDetached(JobOptions{}, counter, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /// @brief Submits a counted function (job) with explicit options. See SubmitDetached(JobCounter&, ...).
+    template <class F, class... Args>
+        requires std::invocable<F, Args...>
+    void SubmitDetached(const JobOptions& options, JobCounter& counter, F&& f, Args&&... args)
+    {
+        counter.Add(1);
+        Enqueue(Job::Create(
+                    [this, &counter, f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable
+                    {
+                        if (!IsCancellationRequested())
+                            std::invoke(std::move(f), std::move(args)...);
+                        Signal(counter);
+                    }),
+                options);
+    }
+
+    /// @brief Submits a function (job) and returns a JobSystem-aware handle to its result.
+    /// @details The handle's Wait() and Get() help execute queued jobs instead of blocking the thread.
+    /// Exceptions thrown by the job are captured and rethrown by JobHandle::Get().
+    /// @tparam F The type of the function object.
+    /// @tparam Args The types of the arguments to pass to the function.
+    /// @param f The function to execute.
+    /// @param args The arguments to forward to the function.
+    /// @return A handle to the job's result. Its shared state is the only heap allocation.
+    template <class F, class... Args>
+        requires std::invocable<F, Args...>
+    auto Spawn(F&& f, Args&&... args) -> JobHandle<std::invoke_result_t<F, Args...>>
+    {
+        return Spawn(JobOptions{}, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /// @brief Spawns a function (job) with explicit options. See Spawn().
+    template <class F, class... Args>
+        requires std::invocable<F, Args...>
+    auto Spawn(const JobOptions& options, F&& f, Args&&... args) -> JobHandle<std::invoke_result_t<F, Args...>>
+    {
+        using return_type = std::invoke_result_t<F, Args...>;
+        using State       = typename JobHandle<return_type>::State;
+
+        auto state = std::make_shared<State>();
+        Enqueue(Job::Create(
+                    [this, state, f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable
+                    {
+                        try
+                        {
+                            if (IsCancellationRequested())
+                                throw JobCancelledError();
+
+                            if constexpr (std::is_void_v<return_type>)
+                            {
+                                std::invoke(std::move(f), std::move(args)...);
+                                state->Result.emplace(true);
+                            }
+                            else
+                            {
+                                state->Result.emplace(std::invoke(std::move(f), std::move(args)...));
+                            }
+                        }
+                        catch (...)
+                        {
+                            state->Exception = std::current_exception();
+                        }
+                        Signal(state->Counter);
+                    }),
+                options);
+        return JobHandle<return_type>(this, std::move(state));
+    }
+
+    /// @brief Submits one job per callable of a range at once and returns a handle to wait for all of them.
+    /// @details Much cheaper than submitting in a loop for large fan-outs: the jobs are queued in chunks of
+    /// kBatchChunkSize under a single lock each, and sleeping workers are woken together, as many as there are
+    /// jobs, instead of once per job. Callables are copied out of lvalue ranges and moved out of rvalue ones.
+    /// @code
+    /// auto group = jobSystem.SubmitBatch(std::views::iota(0, 256) |
+    ///                                    std::views::transform([&](int i) { return [&, i] { Process(i); }; }));
+    /// group.Wait();
+    /// @endcode
+    /// @param callables The functions to execute. Their return values are discarded.
+    /// @return A handle to the whole batch. Its counter is the only heap allocation.
+    template <JobRange R> JobGroup SubmitBatch(R&& callables)
+    {
+        return SubmitBatch(JobOptions{}, std::forward<R>(callables));
+    }
+
+    /// @brief Submits a batch with explicit options. See SubmitBatch().
+    template <JobRange R> JobGroup SubmitBatch(const JobOptions& options, R&& callables)
+    {
+        auto counter = std::make_shared<JobCounter>();
+        EnqueueRange(options, std::forward<R>(callables), counter);
+        return JobGroup(this, std::move(counter));
+    }
+
+    /// @brief Submits a batch that signals 'counter' once per job, without allocating.
+    /// @details Wait for the group with Wait(counter) only after SubmitBatch() has returned.
+    /// @param counter The counter to signal. Must outlive the jobs.
+    template <JobRange R> void SubmitBatch(JobCounter& counter, R&& callables)
+    {
+        SubmitBatch(JobOptions{}, counter, std::forward<R>(callables));
+    }
+
+    /// @brief Submits a counted batch with explicit options. See SubmitBatch(JobCounter&, ...).
+    template <JobRange R> void SubmitBatch(const JobOptions& options, JobCounter& counter, R&& callables)
+    {
+        EnqueueRange(options, std::forward<R>(callables), &counter);
+    }
+
+    /// @brief The number of jobs SubmitBatch() queues per lock.
+    static constexpr std::size_t kBatchChunkSize = 128;
+
+    /// @brief Submits a function (job) once 'delay' has passed, without a thread sleeping meanwhile.
+    /// @details The timer thread moves the job into the queues when it is due (see TimerWheel), after which it
+    /// runs like any SubmitDetached() job: with the given options and dropped if its cancellation group is
+    /// cancelled by then.
+    /// @param delay The minimum time until the job is submitted. Rounded up to TimerWheel::kTickDuration.
+    /// @param f The function to execute. Its return value is discarded.
+    /// @return A handle to cancel the timer with CancelTimer().
+    template <class F>
+        requires std::invocable<F>
+    TimerHandle SubmitAfter(std::chrono::steady_clock::duration delay, F&& f)
+    {
+        return SubmitAfter(JobOptions{}, delay, std::forward<F>(f));
+    }
+
+    /// @brief Submits a delayed function (job) with explicit options. See SubmitAfter().
+    template <class F>
+        requires std::invocable<F>
+    TimerHandle SubmitAfter(const JobOptions& options, std::chrono::steady_clock::duration delay, F&& f)
+    {
+        return ScheduleTimer(Job::Create(
+                                 [f = std::forward<F>(f)]() mutable
+                                 {
+                                     if (!IsCancellationRequested())
+                                         std::invoke(std::move(f));
+                                 }),
+                             options, delay);
+    }
+
+    /// @brief Submits a function (job) every 'period', the first time one period from now, until cancelled.
+    /// @details A firing does not wait for the previous job to finish, so slow jobs may overlap; firings missed
+    /// while the system was busy are skipped. The timer also ends once options.Cancellation is stopped.
+    /// @param period The time between two submissions. Rounded up to TimerWheel::kTickDuration.
+    /// @param f The function to execute. Copied into every job's shared state once, not per firing.
+    /// @return A handle to stop the timer with CancelTimer().
+    template <class F>
+        requires std::invocable<F&>
+    TimerHandle SubmitEvery(std::chrono::steady_clock::duration period, F&& f)
+    {
+        return SubmitEvery(JobOptions{}, period, std::forward<F>(f));
+    }
+
+    /// @brief Submits a periodic function (job) with explicit options. See SubmitEvery().
+    template <class F>
+        requires std::invocable<F&>
+    TimerHandle SubmitEvery(const JobOptions& options, std::chrono::steady_clock::duration period, F&& f)
+    {
+        return ScheduleRepeatingTimer(std::function<void()>(std::forward<F>(f)), options, period);
+    }
+
+    /// @brief Stops a timer before it fires (one-shot) or fires again (periodic). O(1).
+    /// @details Jobs the timer already submitted are not affected; use a CancellationGroup for those.
+    /// @return False if the handle is stale: the timer already fired, was cancelled or never existed.
+    bool CancelTimer(TimerHandle handle);
+
+    /// @brief Signals 'count' completions on a counter and wakes the threads waiting on it.
+    /// @details Called for you by the counted submit functions. Call it directly only for counters you
+    /// Add() to yourself, e.g. work completed outside of a job. The counter is not touched once it reaches zero.
+    void Signal(JobCounter& counter, uint32_t count = 1);
+
+    /// @brief Runs queued jobs on the calling thread until 'counter' is done (helping wait).
+    /// @details Any thread may wait, including workers of this system from inside a job, without starving the
+    /// pool: a waiting worker keeps executing jobs. The thread only sleeps when there is nothing to help with.
+    /// @warning The helper may pick up any queued job, so a frame-critical thread can end up running a long one.
+    void Wait(const JobCounter& counter);
+
+    /// @brief Checks whether the job running on the calling thread has been cancelled (see CancellationGroup).
+    /// @details Long jobs poll this to stop early. Always false outside of jobs and for jobs without a token.
+    static bool IsCancellationRequested() { return Job::GetCurrentStopToken().stop_requested(); }
+
+    /// @brief Gets the stop token of the job running on the calling thread, e.g. to submit follow-up jobs to the
+    /// same group or to register a std::stop_callback. Empty outside of jobs.
+    static std::stop_token GetStopToken() { return Job::GetCurrentStopToken(); }
+
+    /// @brief Runs at most one queued job on the calling thread.
+    /// @details Lets a thread (e.g. the main thread at a frame sync point) help drain the pool instead of idling.
+    /// @return True if a job was executed.
+    bool RunPendingJob();
 
-        std::future<return_type> res = task->get_future();
+    /// @brief Awaitable that moves the awaiting coroutine onto one of the workers.
+    struct ScheduleAwaiter
+    {
+        JobSystem* System;
+        JobOptions Options;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const
         {
-            // Lock the queue to safely add the new task
-            std::unique_lock lock(m_QueueMutex);
+            // Bypasses the cancellation check of SubmitDetached(): a dropped resume would leak the coroutine.
+            System->Enqueue(Job::Create([handle]() { handle.resume(); }), Options);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    /// @brief Suspends the awaiting coroutine and resumes it as a job (see Nodens::Task).
+    /// @details Always goes through the queue, even from a worker, so it can also be used to yield.
+    /// The coroutine is resumed even if options.Cancellation is stopped; it can check IsCancellationRequested()
+    /// after the co_await and return early.
+    /// @code co_await jobSystem.Schedule(); // continues on a worker @endcode
+    /// @param options The options of the job that resumes the coroutine.
+    inline ScheduleAwaiter Schedule(const JobOptions& options = {}) { return ScheduleAwaiter{this, options}; }
+
+    /// @brief While higher priorities have work, each lower priority is still served one job per this period,
+    /// so a steady stream of critical work cannot starve the others.
+    static constexpr int64_t kStarvationLimitNs = 50'000'000;
+
+    /// @brief Upper bound of concurrently blocked jobs. Blocking jobs beyond it queue up.
+    static constexpr unsigned int kMaxBlockingThreads = 64;
+
+    /// @brief How long an idle blocking thread lingers before it exits.
+    static constexpr std::chrono::milliseconds kBlockingIdleTimeout{10'000};
+
+    /// @brief Gets the job pool counters, e.g. to verify that submissions do not hit the heap.
+    static JobAllocationStats GetAllocationStats() { return Job::GetAllocationStats(); }
 
-            // We wrap the task in a generic void lambda because the queue
-            // only holds std::function<void()>.
-            m_Tasks.emplace([task]() { (*task)(); });
+    /// @brief Reads the telemetry counters of every worker, the helping threads and the blocking pool.
+    /// @details Cheap enough to call every frame: the workers are never stopped or locked, so counters of a busy
+    /// system may be a few jobs apart. All counters grow from the system's start; use JobSystemStats::Since() with
+    /// an earlier snapshot for rates.
+    JobSystemStats GetStats() const;
 
-            TracyPlot("Job Queue Size", (int64_t)m_Tasks.size());
+    /// @brief Runs 'fn' over the index range [begin, end) using the workers and the calling thread.
+    /// @details The range is cut into chunks of 'grain' indices. The caller and up to GetWorkerCount() helper
+    /// jobs claim chunks from a shared atomic cursor until none are left, so faster threads simply process more
+    /// chunks. The caller only ever runs chunks of this loop, never unrelated jobs, and returns once every chunk
+    /// has completed. Ranges no larger than 'grain' run inline without touching the job queues.
+    /// @tparam F Either void(std::size_t index) or void(std::size_t chunkBegin, std::size_t chunkEnd).
+    /// The chunked form lets the body keep its inner loop tight (and vectorizable).
+    /// @param begin The first index.
+    /// @param end One past the last index.
+    /// @param grain The number of indices per chunk. 0 picks a grain giving ~4 chunks per thread.
+    /// @param fn The loop body. Invoked concurrently from several threads; it must not throw.
+    template <class F> void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& fn)
+    {
+        ZoneScoped;
+
+        if (begin >= end)
+            return;
+
+        grain = ResolveGrain(end - begin, grain);
+        if (end - begin <= grain || m_Workers.empty())
+        {
+            InvokeRange(fn, begin, end);
+            return;
         }
 
-        // Wake up exactly one worker thread to handle this new task.
-        m_Condition.notify_one();
-        return res;
+        auto body = [&fn](RangeState&, std::size_t chunkBegin, std::size_t chunkEnd)
+        { InvokeRange(fn, chunkBegin, chunkEnd); };
+        RunRange(begin, end, grain, body);
     }
 
+    /// @brief Reduces the index range [begin, end) in parallel.
+    /// @details Uses the same chunking as ParallelFor(). Every participating thread folds the chunks it claims
+    /// into a private partial with 'reduce', and each partial is folded into the result once. Since chunks are
+    /// claimed dynamically, 'reduce' must be associative and commutative.
+    /// @tparam T The result type. Must be copyable.
+    /// @param begin The first index.
+    /// @param end One past the last index.
+    /// @param grain The number of indices per chunk. 0 picks a grain giving ~4 chunks per thread.
+    /// @param identity The neutral element of 'reduce'. Returned for an empty range.
+    /// @param map T(std::size_t chunkBegin, std::size_t chunkEnd): computes the partial result of one chunk.
+    /// @param reduce T(T, T): combines two partial results.
+    /// @return The reduction of all chunks.
+    template <class T, class Map, class Reduce>
+    T ParallelReduce(std::size_t begin, std::size_t end, std::size_t grain, T identity, Map&& map, Reduce&& reduce)
+    {
+        ZoneScoped;
+
+        if (begin >= end)
+            return identity;
+
+        grain = ResolveGrain(end - begin, grain);
+        if (end - begin <= grain || m_Workers.empty())
+            return reduce(std::move(identity), map(begin, end));
+
+        T          result = identity;
+        std::mutex resultMutex;
+
+        // Each participant enters the body once, with its first chunk, and keeps its partial on its own stack.
+        auto body = [&](RangeState& state, std::size_t firstBegin, std::size_t firstEnd)
+        {
+            T partial = map(firstBegin, firstEnd);
+            for (std::size_t claimed = 1;; ++claimed)
+            {
+                std::size_t chunkBegin, chunkEnd;
+                if (!ClaimChunk(state, chunkBegin, chunkEnd))
+                {
+                    {
+                        std::scoped_lock lock(resultMutex);
+                        result = reduce(std::move(result), std::move(partial));
+                    }
+                    CompleteChunks(state, claimed);
+                    return;
+                }
+                partial = reduce(std::move(partial), map(chunkBegin, chunkEnd));
+            }
+        };
+        RunRange<true>(begin, end, grain, body);
+        return result;
+    }
+
+    /// @brief Gets the number of compute worker threads owned by this system.
+    inline unsigned int GetWorkerCount() const { return static_cast<unsigned int>(m_Workers.size()); }
+
+    /// @brief Gets the number of threads currently alive in the blocking pool.
+    unsigned int GetBlockingThreadCount() const;
+
+    /// @brief Gets the index of the calling worker thread.
+    /// @return The worker index, or -1 if the caller is not one of this system's workers.
+    int GetCurrentWorkerIndex() const;
+
 private:
+    // Submits its nodes through Enqueue(), which never drops a job, and checks for cancellation itself.
+    friend class JobGraph;
+
+    // Moves due timer jobs into the queues.
+    friend class TimerWheel;
+
+    // Moves tokens between stages through Enqueue(), a dropped job would lose a token.
+    friend class PipelineBase;
+
+    /// @brief Shared bookkeeping of one ParallelFor/ParallelReduce call.
+    /// @details Lives in a pooled slot and is reference counted, because helper jobs may only start after the
+    /// caller has already returned (all chunks taken by others). Such late helpers find no chunk and leave
+    /// without touching the body, which lives on the caller's stack.
+    struct alignas(kCacheLineSize) RangeState
+    {
+        std::atomic<std::size_t> NextChunk       = 0;
+        std::atomic<std::size_t> CompletedChunks = 0;
+        std::atomic<uint32_t>    RefCount        = 0;
+
+        std::size_t Begin      = 0;
+        std::size_t End        = 0;
+        std::size_t Grain      = 0;
+        std::size_t ChunkCount = 0;
+
+        /// @brief Type-erased participant loop and the caller-owned body it drives.
+        void (*Participate)(RangeState&, void* body) = nullptr;
+        void* Body                                   = nullptr;
+    };
+
+    using RangeStatePool = BlockPool<sizeof(RangeState)>;
+
+    template <class F> static void InvokeRange(F& fn, std::size_t begin, std::size_t end)
+    {
+        if constexpr (std::is_invocable_v<F&, std::size_t, std::size_t>)
+        {
+            fn(begin, end);
+        }
+        else
+        {
+            for (std::size_t i = begin; i < end; ++i)
+                fn(i);
+        }
+    }
+
+    std::size_t ResolveGrain(std::size_t count, std::size_t grain) const
+    {
+        if (grain > 0)
+            return grain;
+        std::size_t targetChunks = 4 * (m_Workers.size() + 1);
+        return std::max<std::size_t>(1, (count + targetChunks - 1) / targetChunks);
+    }
+
+    /// @brief Claims the next unprocessed chunk.
+    /// @return False once the range is exhausted.
+    static bool ClaimChunk(RangeState& state, std::size_t& chunkBegin, std::size_t& chunkEnd)
+    {
+        std::size_t chunk = state.NextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= state.ChunkCount)
+            return false;
+        chunkBegin = state.Begin + chunk * state.Grain;
+        chunkEnd   = std::min(chunkBegin + state.Grain, state.End);
+        return true;
+    }
+
+    /// @brief Reports finished chunks and wakes the caller once the whole range is done.
+    static void CompleteChunks(RangeState& state, std::size_t count)
+    {
+        if (state.CompletedChunks.fetch_add(count, std::memory_order_acq_rel) + count == state.ChunkCount)
+            state.CompletedChunks.notify_all();
+    }
+
+    static void ReleaseRangeState(RangeState* state)
+    {
+        if (state->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::destroy_at(state);
+            RangeStatePool::Free(state);
+        }
+    }
+
+    /// @brief Shared driver of ParallelFor() and ParallelReduce().
+    /// @tparam SelfCompleting True when the body reports its own completed chunks (reductions fold their partial
+    /// first). Otherwise each chunk is reported as soon as it has run.
+    /// @param body void(RangeState&, chunkBegin, chunkEnd), invoked with the first chunk a participant claimed.
+    template <bool SelfCompleting = false, class Body>
+    void RunRange(std::size_t begin, std::size_t end, std::size_t grain, Body& body)
+    {
+        RangeState* state = new (RangeStatePool::Allocate()) RangeState();
+        state->Begin       = begin;
+        state->End         = end;
+        state->Grain       = grain;
+        state->ChunkCount  = (end - begin + grain - 1) / grain;
+        state->Body        = &body;
+        state->Participate = [](RangeState& state, void* bodyPtr)
+        {
+            Body&       body = *static_cast<Body*>(bodyPtr);
+            std::size_t chunkBegin, chunkEnd;
+            if (!ClaimChunk(state, chunkBegin, chunkEnd))
+                return;
+
+            if constexpr (SelfCompleting)
+            {
+                body(state, chunkBegin, chunkEnd);
+            }
+            else
+            {
+                do
+                {
+                    body(state, chunkBegin, chunkEnd);
+                    CompleteChunks(state, 1);
+                } while (ClaimChunk(state, chunkBegin, chunkEnd));
+            }
+        };
+
+        const std::size_t helpers =
+            std::min<std::size_t>(state->ChunkCount - 1, static_cast<std::size_t>(m_Workers.size()));
+        state->RefCount.store(static_cast<uint32_t>(helpers + 1), std::memory_order_relaxed);
+
+        // The caller is blocked until every chunk is done, so the helpers inherit the priority of the job it runs
+        // in; a thread outside the pool (e.g. the main thread) gets critical helpers.
+        const JobOptions options{.Priority = GetRangePriority()};
+        for (std::size_t i = 0; i < helpers; ++i)
+        {
+            SubmitDetached(
+                options,
+                [state]()
+                {
+                    ZoneScopedN("ParallelFor Helper");
+                    state->Participate(*state, state->Body);
+                    ReleaseRangeState(state);
+                });
+        }
+
+        // The calling thread takes part too, then waits for chunks still running elsewhere.
+        state->Participate(*state, state->Body);
+        for (std::size_t done = state->CompletedChunks.load(std::memory_order_acquire); done != state->ChunkCount;
+             done             = state->CompletedChunks.load(std::memory_order_acquire))
+        {
+            state->CompletedChunks.wait(done, std::memory_order_acquire);
+        }
+
+        ReleaseRangeState(state);
+    }
+
+    /// @brief Gets the priority of ParallelFor()/ParallelReduce() helper jobs started on the calling thread.
+    JobPriority GetRangePriority() const;
+
+    /// @brief Per-worker state. Aligned to a cache line so neighbouring workers don't false-share.
+    struct alignas(kCacheLineSize) Worker
+    {
+        /// @brief Local double-ended queues, one per priority. The owner works on the back, thieves take from
+        /// the front.
+        std::array<JobQueue, kJobPriorityCount> Jobs;
+
+        /// @brief Mutex to protect access to Jobs. Only contended while being stolen from.
+        TracyLockable(std::mutex, Mutex);
+
+        /// @brief Telemetry, only written by the worker itself. On its own cache line, away from the thieves.
+        JobCounters Counters;
+    };
+
     /// @brief The main loop executed by every worker thread.
     /// @param stoken The C++20 stop_token used to check if a stop has been requested.
-    void WorkerLoop(std::stop_token stoken);
+    /// @param index The index of the worker running this loop.
+    void WorkerLoop(std::stop_token stoken, unsigned int index);
+
+    /// @brief Routes a job to its pool. Compute jobs go to the local deque or the injection queue of their
+    /// priority and wake a worker.
+    void Enqueue(Job* job, const JobOptions& options);
+
+    /// @brief Hands a one-shot timer job to the timer wheel. Non-template half of SubmitAfter().
+    TimerHandle ScheduleTimer(Job* job, const JobOptions& options, std::chrono::steady_clock::duration delay);
+
+    /// @brief Hands a periodic callback to the timer wheel. Non-template half of SubmitEvery().
+    TimerHandle ScheduleRepeatingTimer(std::function<void()> callback, const JobOptions& options,
+                                       std::chrono::steady_clock::duration period);
+
+    /// @brief Routes several jobs of the same options to their pool under a single lock, and wakes as many
+    /// sleeping workers as there are jobs.
+    void EnqueueBatch(std::span<Job* const> jobs, const JobOptions& options);
+
+    /// @brief Wraps every callable of a range in a job that signals '*counter', queuing them chunk by chunk.
+    /// @tparam CounterPtr JobCounter* or std::shared_ptr<JobCounter>, copied into every job.
+    template <class R, class CounterPtr> void EnqueueRange(const JobOptions& options, R&& callables, CounterPtr counter)
+    {
+        // Pooled jobs are collected on the stack, so a batch allocates nothing once the pool is warm.
+        std::array<Job*, kBatchChunkSize> chunk;
+        std::size_t                       count = 0;
+
+        auto flush = [&]()
+        {
+            // Every job of the chunk is counted before any of them can run and signal.
+            counter->Add(static_cast<uint32_t>(count));
+            EnqueueBatch(std::span<Job* const>(chunk.data(), count), options);
+            count = 0;
+        };
+
+        for (auto&& f : callables)
+        {
+            chunk[count++] = Job::Create(
+                [this, counter, f = std::forward<decltype(f)>(f)]() mutable
+                {
+                    if (!IsCancellationRequested())
+                        std::invoke(std::move(f));
+                    Signal(*counter);
+                });
+            if (count == chunk.size())
+                flush();
+        }
+        if (count > 0)
+            flush();
+    }
+
+    /// @brief Finds the next job for a thread, highest priority first, except for one job of a starved priority
+    /// per kStarvationLimitNs.
+    /// @param index The index of the calling worker, or -1 for a thread outside the pool (no local deque).
+    /// @return The job, or nullptr if none was found.
+    Job* TryAcquire(int index);
+
+    /// @brief Takes a job of one priority: local deque first, then the injection queue, then stealing.
+    /// @param oldestFirst Take the front of the local deque instead of the back.
+    Job* TryAcquireFrom(Worker* worker, int index, std::size_t level, bool oldestFirst);
+
+    /// @brief Claims the right to serve a lower priority that has been waiting behind higher ones for too long.
+    /// @return True if the calling thread should take a job of 'level' next.
+    bool ClaimStarvedLevel(std::size_t& level);
+
+    /// @brief Attempts to take a job of the given priority from the front of a random victim's deque.
+    /// @param thief The index of the stealing worker, or -1 for a thread outside the pool.
+    Job* TrySteal(int thief, std::size_t level);
+
+    /// @brief The spin and yield phases of an idle worker (see JobSystemConfig).
+    /// @return A job that showed up meanwhile, or nullptr once the idle budget is used up and the worker should park.
+    Job* SpinForJob(const std::stop_token& stoken, unsigned int index);
+
+    /// @brief Pause hints between two looks at the pending count while spinning.
+    static constexpr int kPausesPerSpinCheck = 32;
+
+    /// @brief Bookkeeping shared by every thread that runs a job it acquired.
+    void RunJob(Job* job);
+
+    /// @brief Gets the telemetry block of a worker, or the shared one of the helping threads for index -1.
+    JobCounters& GetCounters(int index);
 
 private:
-    /// @brief The thread-safe queue of tasks pending execution.
-    std::queue<std::move_only_function<void()>> m_Tasks;
+    const JobSystemConfig m_Config;
 
-    /// @brief Mutex to protect access to m_Tasks.
+    /// @brief The queues for jobs submitted from outside the worker threads, one per priority.
+    std::array<JobQueue, kJobPriorityCount> m_InjectionQueues;
+
+    /// @brief Mutex to protect access to m_InjectionQueues.
     TracyLockable(std::mutex, m_QueueMutex);
 
+    /// @brief Number of jobs waiting in any queue. Workers sleep while it is zero.
+    std::atomic<int64_t> m_PendingJobs = 0;
+
+    /// @brief Number of jobs waiting per priority. Lets acquisition skip empty priorities without locking.
+    std::array<std::atomic<int64_t>, kJobPriorityCount> m_PendingByPriority = {};
+
+    /// @brief When each priority was last served by starvation protection, in steady clock nanoseconds.
+    std::array<std::atomic<int64_t>, kJobPriorityCount> m_LastStarvedServe = {};
+
+    /// @brief Per-worker deques, indexed by worker index.
+    std::vector<std::unique_ptr<Worker>> m_Workers;
+
+    /// @brief Workers parked on m_Condition. Enqueue() only takes the sleep mutex when there are some.
+    std::atomic<uint32_t> m_SleepingWorkers = 0;
+
+    /// @brief Threads sleeping in Wait(). Signal() only takes the sleep mutex when there are some.
+    std::atomic<uint32_t> m_SleepingWaiters = 0;
+
+    /// @brief Telemetry of the threads outside the pool that run jobs while waiting.
+    JobCounters m_HelperCounters{true};
+
+    /// @brief Mutex paired with m_Condition for parking idle workers and waiters.
+    TracyLockable(std::mutex, m_SleepMutex);
+
     /// @brief Condition variable to put threads to sleep when there is no work.
     /// @note std::condition_variable_any is required to work with std::stop_token.
     std::condition_variable_any m_Condition;
 
+    /// @brief Elastic pool for WorkerPool::Blocking jobs. Shut down explicitly in the destructor.
+    std::unique_ptr<BlockingPool> m_BlockingPool;
+
+    /// @brief Delayed and periodic jobs. Its thread starts with the first timer. Shut down first in the destructor.
+    std::unique_ptr<TimerWheel> m_TimerWheel;
+
     /// @brief Pool of worker threads.
     /// @note std::jthread (C++20) automatically joins on destruction.
     /// @warning Thread objects need to be declared after the resources they use to ensure
@@ -88,4 +999,24 @@ private:
     std::vector<std::jthread> m_Threads;
 };
 
-} // namespace Nodens
\ No newline at end of file
+inline void JobGroup::Wait() const
+{
+    m_System->Wait(*m_Counter);
+}
+
+template <class T> void JobHandle<T>::Wait() const
+{
+    m_System->Wait(m_State->Counter);
+}
+
+template <class T> decltype(auto) JobHandle<T>::Get() const
+{
+    Wait();
+    if (m_State->Exception)
+        std::rethrow_exception(m_State->Exception);
+
+    if constexpr (!std::is_void_v<T>)
+        return static_cast<const T&>(*m_State->Result);
+}
+
+} // namespace Nodens
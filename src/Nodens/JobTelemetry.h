@@ -0,0 +1,260 @@
+#pragma once
+
+#include "Nodens/Core.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Nodens
+{
+
+/// @brief Gets the current steady clock time in nanoseconds, the time base of all job timestamps.
+inline int64_t NowNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/// @brief A distribution of durations in power-of-two microsecond buckets.
+/// @details Bucket 0 counts durations below 1 us, bucket i those in [2^(i-1), 2^i) us, and the last bucket
+/// everything from about a quarter second up. Coarse, but a fixed size that is cheap to record and to copy.
+struct JobHistogram
+{
+    static constexpr std::size_t kBucketCount = 20;
+
+    std::array<uint64_t, kBucketCount> Buckets = {};
+
+    /// @brief Gets the bucket a duration falls into.
+    static std::size_t GetBucket(int64_t nanoseconds)
+    {
+        const uint64_t microseconds = static_cast<uint64_t>(std::max<int64_t>(nanoseconds, 0)) / 1000;
+        return std::min<std::size_t>(std::bit_width(microseconds), kBucketCount - 1);
+    }
+
+    /// @brief Gets the exclusive upper bound of a bucket in microseconds (the last bucket has none).
+    static double GetUpperBoundUs(std::size_t bucket) { return static_cast<double>(uint64_t(1) << bucket); }
+
+    /// @brief Gets the number of recorded durations.
+    uint64_t GetCount() const
+    {
+        uint64_t count = 0;
+        for (uint64_t bucket : Buckets)
+            count += bucket;
+        return count;
+    }
+
+    /// @brief Estimates a percentile as the upper bound of the bucket it falls into.
+    /// @param fraction The percentile as a fraction, e.g. 0.99.
+    /// @return The bound in microseconds, or 0 if nothing was recorded.
+    double GetPercentileUs(double fraction) const
+    {
+        const uint64_t count = GetCount();
+        if (count == 0)
+            return 0.0;
+
+        const auto target = static_cast<uint64_t>(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(count - 1));
+        uint64_t   seen   = 0;
+        for (std::size_t bucket = 0; bucket < kBucketCount; ++bucket)
+        {
+            seen += Buckets[bucket];
+            if (seen > target)
+                return GetUpperBoundUs(bucket);
+        }
+        return GetUpperBoundUs(kBucketCount - 1);
+    }
+
+    JobHistogram& operator+=(const JobHistogram& other)
+    {
+        for (std::size_t i = 0; i < kBucketCount; ++i)
+            Buckets[i] += other.Buckets[i];
+        return *this;
+    }
+
+    JobHistogram& operator-=(const JobHistogram& earlier)
+    {
+        for (std::size_t i = 0; i < kBucketCount; ++i)
+            Buckets[i] -= earlier.Buckets[i];
+        return *this;
+    }
+};
+
+/// @brief What one thread (or group of threads) of a JobSystem has done since the system started.
+/// @details Counters only grow. Subtract an earlier snapshot to get the activity of an interval.
+struct WorkerStats
+{
+    /// @brief Jobs run to completion, including jobs run inside helping waits.
+    uint64_t JobsExecuted = 0;
+
+    /// @brief Jobs taken from another worker's deque.
+    uint64_t Steals = 0;
+
+    /// @brief Times the worker ran out of spinning and yielding and went to sleep.
+    uint64_t Parks = 0;
+
+    /// @brief Times the worker woke from parking to look for work again.
+    uint64_t WakeUps = 0;
+
+    /// @brief Time spent running jobs. Jobs run inside other jobs (helping waits) are only counted once.
+    std::chrono::nanoseconds BusyTime{0};
+
+    /// @brief Time spent looking for work: spinning, yielding and parked. Zero for threads outside the workers.
+    std::chrono::nanoseconds IdleTime{0};
+
+    /// @brief Time from submission until a thread picked the job up.
+    JobHistogram WaitTime;
+
+    /// @brief Time a job took to run.
+    JobHistogram ExecutionTime;
+
+    /// @brief Gets the share of the measured time spent running jobs, in [0, 1].
+    double GetUtilization() const
+    {
+        const auto total = BusyTime + IdleTime;
+        return total.count() > 0 ? static_cast<double>(BusyTime.count()) / static_cast<double>(total.count()) : 0.0;
+    }
+
+    WorkerStats& operator+=(const WorkerStats& other)
+    {
+        JobsExecuted += other.JobsExecuted;
+        Steals += other.Steals;
+        Parks += other.Parks;
+        WakeUps += other.WakeUps;
+        BusyTime += other.BusyTime;
+        IdleTime += other.IdleTime;
+        WaitTime += other.WaitTime;
+        ExecutionTime += other.ExecutionTime;
+        return *this;
+    }
+
+    WorkerStats& operator-=(const WorkerStats& earlier)
+    {
+        JobsExecuted -= earlier.JobsExecuted;
+        Steals -= earlier.Steals;
+        Parks -= earlier.Parks;
+        WakeUps -= earlier.WakeUps;
+        BusyTime -= earlier.BusyTime;
+        IdleTime -= earlier.IdleTime;
+        WaitTime -= earlier.WaitTime;
+        ExecutionTime -= earlier.ExecutionTime;
+        return *this;
+    }
+};
+
+/// @brief A snapshot of the telemetry of a whole JobSystem, see JobSystem::GetStats().
+struct JobSystemStats
+{
+    /// @brief When the snapshot was taken.
+    std::chrono::steady_clock::time_point Timestamp;
+
+    /// @brief One entry per compute worker, indexed like GetCurrentWorkerIndex().
+    std::vector<WorkerStats> Workers;
+
+    /// @brief Jobs run by threads outside the pool while they help (Wait(), RunPendingJob()).
+    WorkerStats Helpers;
+
+    /// @brief Jobs run by the blocking pool.
+    WorkerStats Blocking;
+
+    /// @brief Gets the sum over the compute workers.
+    WorkerStats GetWorkerTotal() const
+    {
+        WorkerStats total;
+        for (const WorkerStats& worker : Workers)
+            total += worker;
+        return total;
+    }
+
+    /// @brief Gets the activity between an earlier snapshot of the same system and this one.
+    JobSystemStats Since(const JobSystemStats& earlier) const
+    {
+        JobSystemStats delta = *this;
+        for (std::size_t i = 0; i < std::min(delta.Workers.size(), earlier.Workers.size()); ++i)
+            delta.Workers[i] -= earlier.Workers[i];
+        delta.Helpers -= earlier.Helpers;
+        delta.Blocking -= earlier.Blocking;
+        return delta;
+    }
+};
+
+/// @brief The live counters behind a WorkerStats, written by the threads that run jobs.
+/// @details Relaxed atomics on their own cache lines, so recording costs a few uncontended stores and never
+/// synchronizes with anything; a snapshot may be torn across counters, but each counter is exact. A block owned
+/// by a single thread (a compute worker) is updated with plain load/store pairs instead of locked read-modify-write
+/// instructions; blocks shared by several threads use fetch_add.
+class alignas(kCacheLineSize) JobCounters
+{
+public:
+    /// @param shared Whether several threads record into this block.
+    explicit JobCounters(bool shared = false) : m_Shared(shared) {}
+
+    JobCounters(const JobCounters&)            = delete;
+    JobCounters& operator=(const JobCounters&) = delete;
+
+    /// @brief Records a finished job. Negative times mean they were not measured.
+    /// @param outermost False for a job run inside another job, whose time the outer job already covers.
+    void RecordJob(int64_t waitNs, int64_t executionNs, bool outermost)
+    {
+        Add(m_JobsExecuted, 1);
+        if (waitNs >= 0)
+            Add(m_WaitTime[JobHistogram::GetBucket(waitNs)], 1);
+        if (executionNs >= 0)
+        {
+            Add(m_ExecutionTime[JobHistogram::GetBucket(executionNs)], 1);
+            if (outermost)
+                Add(m_BusyNs, static_cast<uint64_t>(executionNs));
+        }
+    }
+
+    inline void RecordIdle(int64_t nanoseconds) { Add(m_IdleNs, static_cast<uint64_t>(nanoseconds)); }
+    inline void RecordSteal() { Add(m_Steals, 1); }
+    inline void RecordPark() { Add(m_Parks, 1); }
+    inline void RecordWakeUp() { Add(m_WakeUps, 1); }
+
+    /// @brief Reads the counters. Safe to call from any thread at any time.
+    WorkerStats Snapshot() const
+    {
+        WorkerStats stats;
+        stats.JobsExecuted = m_JobsExecuted.load(std::memory_order_relaxed);
+        stats.Steals       = m_Steals.load(std::memory_order_relaxed);
+        stats.Parks        = m_Parks.load(std::memory_order_relaxed);
+        stats.WakeUps      = m_WakeUps.load(std::memory_order_relaxed);
+        stats.BusyTime     = std::chrono::nanoseconds(m_BusyNs.load(std::memory_order_relaxed));
+        stats.IdleTime     = std::chrono::nanoseconds(m_IdleNs.load(std::memory_order_relaxed));
+        for (std::size_t i = 0; i < JobHistogram::kBucketCount; ++i)
+        {
+            stats.WaitTime.Buckets[i]      = m_WaitTime[i].load(std::memory_order_relaxed);
+            stats.ExecutionTime.Buckets[i] = m_ExecutionTime[i].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+private:
+    inline void Add(std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        if (m_Shared)
+            counter.fetch_add(value, std::memory_order_relaxed);
+        else
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+private:
+    const bool m_Shared;
+
+    std::atomic<uint64_t> m_JobsExecuted = 0;
+    std::atomic<uint64_t> m_Steals       = 0;
+    std::atomic<uint64_t> m_Parks        = 0;
+    std::atomic<uint64_t> m_WakeUps      = 0;
+    std::atomic<uint64_t> m_BusyNs       = 0;
+    std::atomic<uint64_t> m_IdleNs       = 0;
+
+    std::array<std::atomic<uint64_t>, JobHistogram::kBucketCount> m_WaitTime      = {};
+    std::array<std::atomic<uint64_t>, JobHistogram::kBucketCount> m_ExecutionTime = {};
+};
+
+} // namespace Nodens
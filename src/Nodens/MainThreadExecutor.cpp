@@ -0,0 +1,32 @@
+#include "MainThreadExecutor.h"
+
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+namespace Nodens
+{
+
+std::size_t MainThreadExecutor::Drain()
+{
+    ZoneScoped;
+
+    using Clock         = std::chrono::steady_clock;
+    const auto deadline = Clock::now() + m_Budget;
+
+    // An item still being pushed when the queue runs dry simply waits for the next frame.
+    std::size_t count = 0;
+    while (Job* work = m_Queue.Pop())
+    {
+        work->Run();
+        count++;
+
+        // Checked after each item: one item always runs, and one slow item at most overruns the budget.
+        if (Clock::now() >= deadline)
+            break;
+    }
+
+    ZoneValue(count);
+    return count;
+}
+
+} // namespace Nodens
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Nodens/Job.h"
+#include "Nodens/MpscJobQueue.h"
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Nodens
+{
+
+/// @brief Runs work posted from any thread on the main thread, a bounded amount of it per frame.
+/// @details Post() pushes onto a lock-free MpscJobQueue: one atomic exchange per item, never a lock, so workers
+/// reporting results do not contend with the frame. The work is stored in a pooled Job, so posting does not allocate
+/// once the pools are warm. Application::Run() drains the queue once per frame until it is empty or the budget is
+/// spent; what is left carries over to the next frame, so a burst of results is spread over several frames instead
+/// of stalling one. Work still queued when the executor is destroyed is discarded without running.
+class MainThreadExecutor
+{
+public:
+    /// @brief The default time Drain() may spend per frame.
+    static constexpr std::chrono::microseconds kDefaultBudget{2000};
+
+    /// @brief Queues 'f' to run on the main thread during a coming frame. Thread-safe and lock-free.
+    /// @details Work posted by one thread runs in the order it was posted. Work posted while the queue is drained
+    /// may run in the same frame.
+    template <class F>
+        requires std::invocable<std::decay_t<F>&>
+    void Post(F&& f)
+    {
+        m_Queue.Push(Job::Create(std::forward<F>(f)));
+    }
+
+    /// @brief Runs queued work until the queue is empty or the budget is spent. Main thread only.
+    /// @details At least one item runs per call, so the queue always makes progress, even with a budget of zero.
+    /// @return The number of items run.
+    std::size_t Drain();
+
+    /// @brief Sets the time Drain() may spend per frame. Main thread only.
+    inline void SetBudget(std::chrono::microseconds budget) { m_Budget = budget; }
+
+    /// @brief Gets the time Drain() may spend per frame.
+    inline std::chrono::microseconds GetBudget() const { return m_Budget; }
+
+private:
+    MpscJobQueue              m_Queue;
+    std::chrono::microseconds m_Budget = kDefaultBudget;
+};
+
+} // namespace Nodens
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Nodens/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+#include <tracy/Tracy.hpp>
+
+namespace Nodens
+{
+
+/// @brief Counters describing the state of a BlockPool.
+struct BlockPoolStats
+{
+    /// @brief Number of chunks requested from the heap so far. Each chunk holds many blocks.
+    uint64_t ChunkAllocations = 0;
+
+    /// @brief Number of blocks owned by the pool (free or handed out).
+    uint64_t BlockCapacity = 0;
+};
+
+/// @brief A process-wide, thread-safe pool of fixed-size blocks.
+/// @details Blocks are carved out of large chunks that are never returned to the heap, so once the
+/// pool is warm Allocate() and Free() never touch the system allocator. Each thread keeps a small
+/// intrusive free list of its own; the shared list is only locked to move a whole batch of blocks
+/// between threads, which happens when one thread allocates (e.g. the main thread submitting jobs)
+/// and another frees (e.g. the worker that ran them).
+/// @tparam BlockSize The size of each block in bytes.
+/// @tparam Alignment The alignment of each block. Defaults to a cache line.
+template <std::size_t BlockSize, std::size_t Alignment = kCacheLineSize> class BlockPool
+{
+    static_assert(BlockSize >= sizeof(void*), "Blocks must be able to hold a free-list link.");
+    static_assert(BlockSize % Alignment == 0, "Block size must be a multiple of the alignment.");
+
+public:
+    /// @brief Takes a block from the calling thread's cache, refilling it from the shared pool if needed.
+    /// @return Uninitialized storage of BlockSize bytes, aligned to Alignment.
+    static void* Allocate()
+    {
+        LocalCache& local = GetLocal();
+        if (!local.Head)
+            Refill(local);
+
+        FreeNode* node = local.Head;
+        local.Head     = node->Next;
+        local.Count--;
+        return node;
+    }
+
+    /// @brief Returns a block to the calling thread's cache. Any thread may free any block.
+    /// @param block A pointer previously returned by Allocate().
+    static void Free(void* block)
+    {
+        LocalCache& local = GetLocal();
+
+        FreeNode* node = static_cast<FreeNode*>(block);
+        node->Next     = local.Head;
+        local.Head     = node;
+        local.Count++;
+
+        if (local.Count >= kMaxCachedBlocks)
+            Flush(local, kBatchSize);
+    }
+
+    /// @brief Gets a snapshot of the pool counters.
+    static BlockPoolStats GetStats()
+    {
+        uint64_t chunks = GetShared().ChunkAllocations.load(std::memory_order_relaxed);
+        return {chunks, chunks * kBlocksPerChunk};
+    }
+
+private:
+    static constexpr std::size_t kBlocksPerChunk  = 256;
+    static constexpr std::size_t kBatchSize       = 64;
+    static constexpr std::size_t kMaxCachedBlocks = 2 * kBatchSize;
+
+    struct FreeNode
+    {
+        FreeNode* Next;
+    };
+
+    struct Shared
+    {
+        std::mutex            Mutex;
+        FreeNode*             Head             = nullptr;
+        std::size_t           Count            = 0;
+        std::atomic<uint64_t> ChunkAllocations = 0;
+    };
+
+    /// @brief Per-thread cache. Gives its blocks back to the shared pool when the thread exits.
+    struct LocalCache
+    {
+        FreeNode*   Head  = nullptr;
+        std::size_t Count = 0;
+
+        ~LocalCache() { Flush(*this, Count); }
+    };
+
+    static Shared& GetShared()
+    {
+        // Intentionally leaked: blocks may still be freed by threads exiting during static destruction.
+        static Shared* shared = new Shared();
+        return *shared;
+    }
+
+    static LocalCache& GetLocal()
+    {
+        static thread_local LocalCache local;
+        return local;
+    }
+
+    /// @brief Moves a batch from the shared list into the local cache, allocating a chunk if it is empty.
+    static void Refill(LocalCache& local)
+    {
+        Shared&          shared = GetShared();
+        std::scoped_lock lock(shared.Mutex);
+
+        if (!shared.Head)
+        {
+            auto* chunk =
+                static_cast<std::byte*>(::operator new(BlockSize * kBlocksPerChunk, std::align_val_t{Alignment}));
+            TracyAlloc(chunk, BlockSize * kBlocksPerChunk);
+            shared.ChunkAllocations.fetch_add(1, std::memory_order_relaxed);
+
+            for (std::size_t i = 0; i < kBlocksPerChunk; ++i)
+            {
+                auto* node  = reinterpret_cast<FreeNode*>(chunk + i * BlockSize);
+                node->Next  = shared.Head;
+                shared.Head = node;
+            }
+            shared.Count += kBlocksPerChunk;
+        }
+
+        for (std::size_t i = 0; i < kBatchSize && shared.Head; ++i)
+        {
+            FreeNode* node = shared.Head;
+            shared.Head    = node->Next;
+            shared.Count--;
+
+            node->Next = local.Head;
+            local.Head = node;
+            local.Count++;
+        }
+    }
+
+    /// @brief Moves up to 'count' blocks from the local cache back to the shared list.
+    static void Flush(LocalCache& local, std::size_t count)
+    {
+        if (count == 0 || !local.Head)
+            return;
+
+        Shared&          shared = GetShared();
+        std::scoped_lock lock(shared.Mutex);
+
+        for (std::size_t i = 0; i < count && local.Head; ++i)
+        {
+            FreeNode* node = local.Head;
+            local.Head     = node->Next;
+            local.Count--;
+
+            node->Next  = shared.Head;
+            shared.Head = node;
+            shared.Count++;
+        }
+    }
+};
+
+} // namespace Nodens
@@ -0,0 +1,180 @@
+#include "ScratchArena.h"
+
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace Nodens
+{
+
+struct ScratchArena::Block
+{
+    Block*      Previous;
+    std::size_t Size;
+
+    inline std::byte* GetData() { return reinterpret_cast<std::byte*>(this) + sizeof(Block); }
+};
+
+// The arenas of all living threads, so EndFrame() can report their peaks.
+static std::mutex& GetRegistryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::vector<ScratchArena*>& GetRegistry()
+{
+    static std::vector<ScratchArena*> registry;
+    return registry;
+}
+
+namespace
+{
+
+// Owns a thread's arena and keeps it registered while the thread lives.
+struct ThreadArena
+{
+    ScratchArena Arena;
+
+    ThreadArena()
+    {
+        std::scoped_lock lock(GetRegistryMutex());
+        GetRegistry().push_back(&Arena);
+    }
+
+    ~ThreadArena()
+    {
+        std::scoped_lock lock(GetRegistryMutex());
+        std::erase(GetRegistry(), &Arena);
+    }
+};
+
+} // namespace
+
+ScratchArena::ScratchArena(std::size_t initialCapacity, std::pmr::memory_resource* upstream)
+    : m_Upstream(upstream), m_InitialCapacity(std::max<std::size_t>(initialCapacity, 1))
+{
+}
+
+ScratchArena::~ScratchArena()
+{
+    ReleaseBlocks();
+}
+
+ScratchArena& ScratchArena::Get()
+{
+    static thread_local ThreadArena arena;
+    return arena.Arena;
+}
+
+void ScratchArena::EndFrame()
+{
+    ZoneScoped;
+
+    // The peaks are only read by the profiler, but exchanging them also starts the next frame's measurement.
+    ScratchArena&                main     = Get();
+    [[maybe_unused]] std::size_t mainPeak = main.m_Peak.exchange(0, std::memory_order_relaxed);
+    main.Reset();
+
+    [[maybe_unused]] std::size_t workerPeak = 0;
+    {
+        std::scoped_lock lock(GetRegistryMutex());
+        for (ScratchArena* arena : GetRegistry())
+        {
+            if (arena != &main)
+                workerPeak = std::max(workerPeak, arena->m_Peak.exchange(0, std::memory_order_relaxed));
+        }
+    }
+
+    TracyPlot("Scratch Peak (Main Thread)", static_cast<int64_t>(mainPeak));
+    TracyPlot("Scratch Peak (Workers)", static_cast<int64_t>(workerPeak));
+    TracyPlot("Scratch Capacity (Main Thread)", static_cast<int64_t>(main.m_Capacity));
+}
+
+void ScratchArena::Reset()
+{
+    m_Offset = 0;
+    m_Used   = 0;
+
+    // Fold a chain of blocks into one of the combined size, so the same load fits without growing next time.
+    if (m_Current && m_Current->Previous)
+    {
+        const std::size_t capacity = m_Capacity;
+        ReleaseBlocks();
+        Grow(capacity, 1);
+    }
+}
+
+void* ScratchArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    while (true)
+    {
+        if (m_Current)
+        {
+            std::byte*        data    = m_Current->GetData();
+            const uintptr_t   start   = reinterpret_cast<uintptr_t>(data) + m_Offset;
+            const uintptr_t   aligned = (start + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            const std::size_t end     = static_cast<std::size_t>(aligned - reinterpret_cast<uintptr_t>(data)) + bytes;
+            if (end <= m_Current->Size)
+            {
+                m_Used += end - m_Offset;
+                m_Offset = end;
+                if (m_Used > m_Peak.load(std::memory_order_relaxed))
+                    m_Peak.store(m_Used, std::memory_order_relaxed);
+                return reinterpret_cast<void*>(aligned);
+            }
+        }
+        Grow(bytes, alignment);
+    }
+}
+
+void ScratchArena::Grow(std::size_t bytes, std::size_t alignment)
+{
+    ZoneScoped;
+    static_assert(sizeof(Block) % alignof(std::max_align_t) == 0, "Block data must start at the upstream alignment.");
+
+    // Doubling keeps the number of blocks per frame logarithmic in the frame's usage.
+    std::size_t size = std::max(m_InitialCapacity, bytes + alignment);
+    if (m_Current)
+        size = std::max(size, 2 * m_Current->Size);
+
+    void* memory = m_Upstream->allocate(sizeof(Block) + size, alignof(std::max_align_t));
+    TracyAlloc(memory, sizeof(Block) + size);
+
+    m_Current = ::new (memory) Block{m_Current, size};
+    m_Offset  = 0;
+    m_Capacity += size;
+}
+
+void ScratchArena::ReleaseBlocks()
+{
+    while (m_Current)
+    {
+        Block*      previous = m_Current->Previous;
+        std::size_t size     = sizeof(Block) + m_Current->Size;
+        TracyFree(m_Current);
+        m_Upstream->deallocate(m_Current, size, alignof(std::max_align_t));
+        m_Current = previous;
+    }
+    m_Offset   = 0;
+    m_Capacity = 0;
+}
+
+ScratchArena::Scope::Scope(ScratchArena& arena)
+    : m_Arena(arena), m_Block(arena.m_Current), m_Offset(arena.m_Offset), m_Used(arena.m_Used)
+{
+}
+
+ScratchArena::Scope::~Scope()
+{
+    if (m_Arena.m_Current == m_Block)
+    {
+        m_Arena.m_Offset = m_Offset;
+        m_Arena.m_Used   = m_Used;
+    }
+}
+
+} // namespace Nodens
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Nodens/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace Nodens
+{
+
+/// @brief A bump allocator for short-lived memory, usable by standard containers through std::pmr.
+/// @details Allocating moves a pointer forward; deallocating does nothing; Reset() releases everything at once.
+/// When the current block is full the arena chains a larger one, and the next Reset() folds the chain into a single
+/// block of the combined size, so after a few frames the arena stops touching the upstream allocator altogether.
+///
+/// Every thread has its own arena, returned by Get(), which needs no locking:
+/// - On the main thread it is frame-scoped: Application::Run() resets it at FrameMark (see EndFrame()).
+/// - On JobSystem workers and blocking threads it is job-scoped: it is reset after every job the thread ran.
+///
+/// Scratch memory must therefore never outlive the frame (main thread) or the job (workers) it was allocated in.
+/// @code
+/// std::pmr::vector<Entity*> visible(&ScratchArena::Get());
+/// @endcode
+class ScratchArena final : public std::pmr::memory_resource
+{
+    /// @brief Header of a block obtained from the upstream allocator, followed by its usable bytes.
+    struct Block;
+
+public:
+    /// @brief The size of the first block of a thread's arena.
+    static constexpr std::size_t kInitialCapacity = 64 * 1024;
+
+    /// @brief Creates an arena. No memory is allocated until the first allocation.
+    /// @param initialCapacity The size of the first block.
+    /// @param upstream Where blocks come from.
+    explicit ScratchArena(std::size_t                 initialCapacity = kInitialCapacity,
+                          std::pmr::memory_resource* upstream        = std::pmr::new_delete_resource());
+
+    ~ScratchArena();
+
+    ScratchArena(const ScratchArena&)            = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    /// @brief Gets the calling thread's arena, created on first use.
+    static ScratchArena& Get();
+
+    /// @brief Ends the frame of the calling (main) thread: resets its arena and plots the peak usage of every
+    /// thread's arena since the previous frame to Tracy. Called by Application::Run() at FrameMark.
+    static void EndFrame();
+
+    /// @brief Releases everything allocated so far. Containers using the arena must be gone by then.
+    void Reset();
+
+    /// @brief Gets the number of bytes handed out since the last Reset(), including alignment padding.
+    inline std::size_t GetUsed() const { return m_Used; }
+
+    /// @brief Gets the number of bytes the arena owns.
+    inline std::size_t GetCapacity() const { return m_Capacity; }
+
+    /// @brief Gets the highest usage since the peak was last reported by EndFrame().
+    inline std::size_t GetHighWaterMark() const { return m_Peak.load(std::memory_order_relaxed); }
+
+    /// @brief Rewinds the arena to where it was when the scope was opened, for scratch memory that is only needed
+    /// for part of a frame or job. Scopes must be closed in reverse order. If the arena had to grow meanwhile, the
+    /// memory is kept until the next Reset() instead.
+    class Scope
+    {
+    public:
+        explicit Scope(ScratchArena& arena = ScratchArena::Get());
+        ~Scope();
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ScratchArena& m_Arena;
+        Block*        m_Block;
+        std::size_t   m_Offset;
+        std::size_t   m_Used;
+    };
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void  do_deallocate(void*, std::size_t, std::size_t) override {}
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    /// @brief Chains a block large enough for 'bytes' at 'alignment'.
+    void Grow(std::size_t bytes, std::size_t alignment);
+
+    /// @brief Returns every block to the upstream allocator.
+    void ReleaseBlocks();
+
+private:
+    std::pmr::memory_resource* m_Upstream;
+    std::size_t                m_InitialCapacity;
+
+    /// @brief The block allocations come from; older blocks are linked behind it.
+    Block*      m_Current = nullptr;
+    std::size_t m_Offset  = 0;
+
+    std::size_t m_Used     = 0;
+    std::size_t m_Capacity = 0;
+
+    /// @brief Written by the owning thread, read and cleared by EndFrame() on the main thread.
+    std::atomic<std::size_t> m_Peak = 0;
+};
+
+} // namespace Nodens
@@ -0,0 +1,66 @@
+#include "MpscJobQueue.h"
+
+#include "ndpch.h"
+
+namespace Nodens
+{
+
+MpscJobQueue::MpscJobQueue() : m_Head(&m_Stub), m_Tail(&m_Stub), m_Stub{{nullptr}, nullptr} {}
+
+MpscJobQueue::~MpscJobQueue()
+{
+    while (Job* job = Pop())
+        job->Discard();
+}
+
+void MpscJobQueue::Push(Job* job)
+{
+    PushNode(::new (NodePool::Allocate()) Node{{nullptr}, job});
+}
+
+void MpscJobQueue::PushNode(Node* node)
+{
+    node->Next.store(nullptr, std::memory_order_relaxed);
+
+    // Claim the end of the queue, then link the previous end to it. Between the two the consumer sees a gap and
+    // stops there (see Pop()), so the exchange is all producers ever contend on.
+    Node* previous = m_Head.exchange(node, std::memory_order_acq_rel);
+    previous->Next.store(node, std::memory_order_release);
+}
+
+Job* MpscJobQueue::Pop()
+{
+    Node* tail = m_Tail;
+    Node* next = tail->Next.load(std::memory_order_acquire);
+
+    // Skip the stub, it carries no job.
+    if (tail == &m_Stub)
+    {
+        if (!next)
+            return nullptr;
+        m_Tail = next;
+        tail   = next;
+        next   = next->Next.load(std::memory_order_acquire);
+    }
+
+    if (!next)
+    {
+        // A producer has claimed the end but not linked it yet.
+        if (tail != m_Head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // 'tail' is the last job. Put the stub behind it, so taking it does not leave the queue without a node.
+        PushNode(&m_Stub);
+        next = tail->Next.load(std::memory_order_acquire);
+        if (!next)
+            return nullptr;
+    }
+
+    m_Tail   = next;
+    Job* job = tail->Work;
+    std::destroy_at(tail);
+    NodePool::Free(tail);
+    return job;
+}
+
+} // namespace Nodens
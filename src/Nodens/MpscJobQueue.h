@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Nodens/Job.h"
+#include "Nodens/Memory/BlockPool.h"
+
+#include <atomic>
+
+namespace Nodens
+{
+
+/// @brief An intrusive, lock-free multi-producer single-consumer queue of jobs (Vyukov's design).
+/// @details Push() is one atomic exchange and one store, never a lock, from any thread. Pop() belongs to a single
+/// consumer at a time. Nodes come from a BlockPool, so a steady stream does not allocate. Jobs pushed by one thread
+/// are popped in the order they were pushed. Backs the MainThreadExecutor and every Strand.
+class MpscJobQueue
+{
+public:
+    MpscJobQueue();
+
+    /// @brief Discards the jobs still queued without running them.
+    ~MpscJobQueue();
+
+    MpscJobQueue(const MpscJobQueue&)            = delete;
+    MpscJobQueue& operator=(const MpscJobQueue&) = delete;
+
+    /// @brief Appends a job. Thread-safe and lock-free. Takes ownership of the job.
+    void Push(Job* job);
+
+    /// @brief Takes the oldest job off the queue. Consumer only.
+    /// @return The job, or null if the queue is empty, or if the next job is still being pushed (a producer was
+    /// interrupted between its two steps; the job shows up as soon as it resumes).
+    Job* Pop();
+
+private:
+    struct Node
+    {
+        std::atomic<Node*> Next;
+        Job*               Work;
+    };
+
+    // Nodes get a cache line each, so producers pushing at the same time do not share one.
+    using NodePool = BlockPool<kCacheLineSize>;
+
+    void PushNode(Node* node);
+
+private:
+    /// @brief The newest node, where producers append. Alone on its cache line, it is all they touch.
+    alignas(kCacheLineSize) std::atomic<Node*> m_Head;
+
+    /// @brief The oldest node, already consumed; its successor is the next job. Touched by the consumer only.
+    alignas(kCacheLineSize) Node* m_Tail;
+
+    /// @brief The node the queue starts out with, recycled whenever the consumer empties it.
+    Node m_Stub;
+};
+
+} // namespace Nodens
@@ -0,0 +1,194 @@
+#include "Pipeline.h"
+
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+#include <algorithm>
+
+namespace Nodens
+{
+
+PipelineBase::PipelineBase(JobSystem& jobSystem, std::size_t tokenCount, const JobOptions& options)
+    : m_JobSystem(jobSystem), m_Options(options), m_Tokens(std::max<std::size_t>(tokenCount, 1))
+{
+    m_FreeTokens.reserve(m_Tokens.size());
+}
+
+void PipelineBase::SetSourceErased(std::function<bool(void*)> source)
+{
+    ND_CORE_ASSERT(IsComplete(), "Cannot modify a Pipeline while it is running!");
+    m_Source = std::move(source);
+}
+
+void PipelineBase::AddStageErased(std::string name, StageMode mode, std::function<void(void*)> work)
+{
+    ND_CORE_ASSERT(IsComplete(), "Cannot modify a Pipeline while it is running!");
+
+    Stage& stage = m_Stages.emplace_back();
+    stage.Name   = std::move(name);
+    stage.Mode   = mode;
+    stage.Work   = std::move(work);
+    if (mode == StageMode::Serial)
+        stage.Waiting.resize(m_Tokens.size(), nullptr);
+}
+
+bool PipelineBase::Run()
+{
+    ZoneScoped;
+
+    if (!IsComplete() || !m_Source)
+        return false;
+
+    m_NextSequence = 0;
+    m_SourceBusy   = false;
+    m_SourceDone   = false;
+    for (Stage& stage : m_Stages)
+        stage.NextSequence = 0;
+
+    // The first token starts the source; the others wait for it in the free list.
+    m_FreeTokens.clear();
+    for (std::size_t i = 1; i < m_Tokens.size(); ++i)
+        m_FreeTokens.push_back(&m_Tokens[i]);
+
+    m_Remaining.Add(static_cast<uint32_t>(m_Tokens.size()));
+
+    // Submitting publishes the state above to the workers.
+    Token* first = &m_Tokens[0];
+    m_JobSystem.Enqueue(Job::Create(
+                            [this, first]()
+                            {
+                                if (Token* token = Refill(first))
+                                    RunToken(token, 0);
+                            }),
+                        m_Options);
+    return true;
+}
+
+void PipelineBase::Wait()
+{
+    ZoneScoped;
+    m_JobSystem.Wait(m_Remaining);
+}
+
+void PipelineBase::Submit(Token* token, std::size_t stage)
+{
+    m_JobSystem.Enqueue(Job::Create([this, token, stage]() { RunToken(token, stage); }), m_Options);
+}
+
+void PipelineBase::RunToken(Token* token, std::size_t stage)
+{
+    // Once the last token is retired the owner may destroy the pipeline, so Refill() returning nullptr is the
+    // last access to it.
+    while (RunStages(token, stage))
+    {
+        token = Refill(token);
+        if (!token)
+            return;
+        stage = 0;
+    }
+}
+
+bool PipelineBase::RunStages(Token* token, std::size_t stage)
+{
+    for (; stage < m_Stages.size(); ++stage)
+    {
+        Stage& current = m_Stages[stage];
+
+        // Serial stages only let in the next item in source order. Items that overtook it park here.
+        if (current.Mode == StageMode::Serial)
+        {
+            std::scoped_lock lock(current.Mutex);
+            if (token->Sequence != current.NextSequence)
+            {
+                current.Waiting[token->Sequence % m_Tokens.size()] = token;
+                return false;
+            }
+        }
+
+        {
+            ZoneScopedN("Pipeline Stage");
+            ZoneName(current.Name.c_str(), current.Name.size());
+            // A cancelled run still moves its items along, so the serial stages keep their order and the run
+            // completes; only the work is skipped.
+            if (!JobSystem::IsCancellationRequested())
+                current.Work(token->Item);
+        }
+
+        if (current.Mode == StageMode::Serial)
+        {
+            // Let in the successor. If it is already parked, it continues as a job, while this item moves on here.
+            Token* successor = nullptr;
+            {
+                std::scoped_lock lock(current.Mutex);
+                current.NextSequence++;
+                Token*& slot = current.Waiting[current.NextSequence % m_Tokens.size()];
+                if (slot && slot->Sequence == current.NextSequence)
+                    successor = std::exchange(slot, nullptr);
+            }
+            if (successor)
+                Submit(successor, stage);
+        }
+    }
+    return true;
+}
+
+PipelineBase::Token* PipelineBase::Refill(Token* token)
+{
+    bool filling = false;
+    {
+        std::scoped_lock lock(m_SourceMutex);
+        if (!m_SourceDone && m_SourceBusy)
+        {
+            // The thread filling tokens picks this one up next.
+            m_FreeTokens.push_back(token);
+            return nullptr;
+        }
+        filling      = !m_SourceDone;
+        m_SourceBusy = filling;
+    }
+
+    while (filling)
+    {
+        bool produced = false;
+        {
+            ZoneScopedN("Pipeline Source");
+            produced = !JobSystem::IsCancellationRequested() && m_Source(token->Item);
+        }
+
+        std::unique_lock lock(m_SourceMutex);
+        if (!produced)
+        {
+            // End of the stream: this token and the idle ones retire, the others once they come back.
+            m_SourceDone = true;
+            m_SourceBusy = false;
+            filling      = false;
+            continue;
+        }
+        token->Sequence = m_NextSequence++;
+
+        // Free tokens left: hand the filled one to another worker and keep producing. Otherwise the filled token
+        // continues on this thread.
+        if (m_FreeTokens.empty())
+        {
+            m_SourceBusy = false;
+            return token;
+        }
+        Token* next = m_FreeTokens.back();
+        m_FreeTokens.pop_back();
+        lock.unlock();
+
+        Submit(token, 0);
+        token = next;
+    }
+
+    uint32_t retired = 1;
+    {
+        std::scoped_lock lock(m_SourceMutex);
+        retired += static_cast<uint32_t>(m_FreeTokens.size());
+        m_FreeTokens.clear();
+    }
+    m_JobSystem.Signal(m_Remaining, retired);
+    return nullptr;
+}
+
+} // namespace Nodens
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "Nodens/JobSystem.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <tracy/Tracy.hpp>
+
+namespace Nodens
+{
+
+/// @brief How a Pipeline stage processes the items flowing through it.
+enum class StageMode : uint8_t
+{
+    /// @brief One item at a time, in the order the source produced them. For stateful steps and ordered output.
+    Serial,
+
+    /// @brief Any number of items at once, on any worker. For stateless steps.
+    Parallel,
+};
+
+/// @brief The type-independent scheduling of a Pipeline. Use Pipeline<T>.
+class PipelineBase
+{
+public:
+    PipelineBase(const PipelineBase&)            = delete;
+    PipelineBase& operator=(const PipelineBase&) = delete;
+
+    /// @brief Starts pulling items from the source and returns immediately.
+    /// @details The first job fills a token from the source; every filled token travels through the stages as one
+    /// job, continuing inline from stage to stage, and goes back to the source once the last stage is done.
+    /// @return False if the pipeline is still running or has no source; nothing is started in that case.
+    bool Run();
+
+    /// @brief Checks without blocking whether the source is exhausted and every item has left the last stage.
+    inline bool IsComplete() const { return m_Remaining.IsDone(); }
+
+    /// @brief Waits for the run to finish, running queued jobs meanwhile (see JobSystem::Wait()).
+    void Wait();
+
+    /// @brief Gets the maximum number of items in flight.
+    inline std::size_t GetTokenCount() const { return m_Tokens.size(); }
+
+    /// @brief Gets the number of stages after the source.
+    inline std::size_t GetStageCount() const { return m_Stages.size(); }
+
+protected:
+    PipelineBase(JobSystem& jobSystem, std::size_t tokenCount, const JobOptions& options);
+    ~PipelineBase() = default;
+
+    /// @brief Gives every token the item it carries. Called once by Pipeline<T>.
+    void BindItem(std::size_t token, void* item) { m_Tokens[token].Item = item; }
+
+    void SetSourceErased(std::function<bool(void*)> source);
+    void AddStageErased(std::string name, StageMode mode, std::function<void(void*)> work);
+
+private:
+    struct Token
+    {
+        void*    Item     = nullptr;
+        uint64_t Sequence = 0;
+    };
+
+    struct Stage
+    {
+        std::string                Name;
+        StageMode                  Mode = StageMode::Parallel;
+        std::function<void(void*)> Work;
+
+        /// @brief Serial stages only: the sequence number allowed in next, and the tokens that arrived early,
+        /// indexed by sequence modulo the token count (all in-flight sequences fit that window).
+        uint64_t            NextSequence = 0;
+        std::vector<Token*> Waiting;
+        TracyLockable(std::mutex, Mutex);
+    };
+
+    /// @brief Moves a token through the stages from 'stage' on and back to the source, until it is parked at a
+    /// serial stage or retired.
+    void RunToken(Token* token, std::size_t stage);
+
+    /// @brief Runs the stages from 'stage' on.
+    /// @return False if the token was parked at a serial stage; whoever lets it in later continues it.
+    bool RunStages(Token* token, std::size_t stage);
+
+    /// @brief Hands a token that left the last stage back to the source.
+    /// @details The source is serial, so only one thread fills tokens at a time; tokens returned meanwhile queue up
+    /// and are filled by that thread, which submits all but the last as jobs.
+    /// @return The refilled token, to continue on the calling thread, or nullptr.
+    Token* Refill(Token* token);
+
+    /// @brief Submits a job that continues a token at 'stage'.
+    void Submit(Token* token, std::size_t stage);
+
+private:
+    JobSystem& m_JobSystem;
+    JobOptions m_Options;
+
+    std::vector<Token> m_Tokens;
+
+    /// @brief Stages are never moved once added (std::deque), and hold a mutex.
+    std::deque<Stage> m_Stages;
+
+    std::function<bool(void*)> m_Source;
+    uint64_t                   m_NextSequence = 0;
+    bool                       m_SourceBusy   = false;
+    bool                       m_SourceDone   = false;
+    std::vector<Token*>        m_FreeTokens;
+
+    /// @brief Mutex to protect the source state and the free tokens.
+    TracyLockable(std::mutex, m_SourceMutex);
+
+    /// @brief Tokens of the current run that have not been retired yet.
+    JobCounter m_Remaining;
+};
+
+/// @brief A stream of items processed by a chain of serial and parallel stages on a JobSystem.
+/// @details A fixed number of tokens, each carrying one preallocated T, circulate between the source and the
+/// stages. The source fills a token (serially, numbering the items), the stages transform it in place and the token
+/// returns to the source once the last stage is done. With no free token the source waits, so memory stays bounded
+/// however fast it produces (backpressure), while up to GetTokenCount() items are processed at once. Serial stages
+/// see the items in source order, whatever order the parallel stages before them finished in.
+/// Re-running a built pipeline performs no heap allocation.
+///
+/// @code
+/// struct Record { std::string Line; Parsed Data; };
+/// Pipeline<Record> pipeline(jobSystem, 16);
+/// pipeline.SetSource([&](Record& r) { return std::getline(file, r.Line).good(); });
+/// pipeline.AddStage("Parse", StageMode::Parallel, [](Record& r) { r.Data = Parse(r.Line); });
+/// pipeline.AddStage("Aggregate", StageMode::Serial, [&](Record& r) { totals.Add(r.Data); });
+/// pipeline.Run();
+/// pipeline.Wait();
+/// @endcode
+/// @tparam T The item type. Default-constructed once per token and reused, so stages should overwrite what they
+/// produce.
+template <class T> class Pipeline : public PipelineBase
+{
+public:
+    /// @brief Creates a pipeline without source or stages.
+    /// @param jobSystem The job system whose workers run the stages. Must outlive the pipeline.
+    /// @param tokenCount The maximum number of items in flight. Around twice the worker count keeps every core busy.
+    /// @param options The options every job is submitted with. Once options.Cancellation is stopped, the source is
+    /// no longer called and the items in flight skip the work of the remaining stages.
+    Pipeline(JobSystem& jobSystem, std::size_t tokenCount, const JobOptions& options = {})
+        : PipelineBase(jobSystem, tokenCount, options), m_Items(GetTokenCount())
+    {
+        for (std::size_t i = 0; i < m_Items.size(); ++i)
+            BindItem(i, &m_Items[i]);
+    }
+
+    /// @brief Waits for a running pipeline before destroying the items.
+    /// @details Waiting goes through the job system, so it must still be alive here: a pipeline owned by a Layer is
+    /// fine, the Application destroys its layers before its JobSystem.
+    ~Pipeline() { Wait(); }
+
+    /// @brief Sets the function producing the items. Called serially; must not throw.
+    /// @param source Fills the given item and returns true, or returns false once the stream has ended.
+    void SetSource(std::function<bool(T&)> source)
+    {
+        SetSourceErased([source = std::move(source)](void* item) { return source(*static_cast<T*>(item)); });
+    }
+
+    /// @brief Appends a stage. Stages run in the order they were added.
+    /// @param name Debug name, used for the stage's Tracy zone.
+    /// @param mode Whether items pass one at a time in order, or concurrently.
+    /// @param work Transforms the item in place. Must not throw.
+    void AddStage(std::string name, StageMode mode, std::function<void(T&)> work)
+    {
+        AddStageErased(std::move(name), mode,
+                       [work = std::move(work)](void* item) { work(*static_cast<T*>(item)); });
+    }
+
+private:
+    std::vector<T> m_Items;
+};
+
+} // namespace Nodens
@@ -0,0 +1,46 @@
+#include "Strand.h"
+
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+#include <thread>
+
+namespace Nodens
+{
+
+Strand::Strand(JobSystem& jobSystem, const JobOptions& options) : m_JobSystem(jobSystem), m_Options(options)
+{
+    // A dropped drain job would leave the strand marked busy with nobody draining it.
+    m_Options.Cancellation = {};
+}
+
+void Strand::Schedule()
+{
+    m_JobSystem.SubmitDetached(m_Options, [this]() { Drain(); });
+}
+
+void Strand::Drain()
+{
+    ZoneScoped;
+
+    for (std::size_t i = 0; i < kMaxJobsPerSlice; ++i)
+    {
+        // The count says there is an item; it may still be on its way into the queue.
+        Job* job = m_Queue.Pop();
+        while (!job)
+        {
+            std::this_thread::yield();
+            job = m_Queue.Pop();
+        }
+
+        job->Run();
+
+        if (m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            return;
+    }
+
+    // More is queued: continue in a new job, behind the work that waited meanwhile.
+    Schedule();
+}
+
+} // namespace Nodens
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Nodens/Job.h"
+#include "Nodens/JobSystem.h"
+#include "Nodens/MpscJobQueue.h"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Nodens
+{
+
+/// @brief A serial executor on top of a JobSystem: work posted to one strand runs in the order it was posted and
+/// never concurrently, while different strands run in parallel on the workers.
+/// @details State touched only from one strand needs no mutex. Posting is lock-free (see MpscJobQueue); the first
+/// post to an idle strand submits a job that drains it, later posts just queue up behind. The drain job hands the
+/// strand over to a fresh job every kMaxJobsPerSlice items, so one busy strand cannot hold a worker forever. No
+/// thread is tied to a strand, so idle strands cost nothing but their memory.
+/// @code
+/// Strand strand(jobSystem);
+/// for (Chunk& chunk : chunks)
+///     strand.Post([&, chunk]() { m_Index.Append(chunk); }); // m_Index needs no lock
+/// @endcode
+class Strand
+{
+public:
+    /// @brief Items one drain job runs before it hands the strand over to a new job.
+    static constexpr std::size_t kMaxJobsPerSlice = 64;
+
+    /// @brief Creates an idle strand.
+    /// @param jobSystem The system the strand runs on. Must outlive the strand.
+    /// @param options The priority and pool of the drain jobs. options.Cancellation is ignored: a strand has to keep
+    /// draining, cancel the posted work itself instead (e.g. by checking a stop_token).
+    explicit Strand(JobSystem& jobSystem, const JobOptions& options = {});
+
+    /// @brief Discards the work still queued. The strand must not be running: wait for its work first.
+    ~Strand() = default;
+
+    Strand(const Strand&)            = delete;
+    Strand& operator=(const Strand&) = delete;
+
+    /// @brief Queues 'f' to run after everything posted to the strand before it. Thread-safe and lock-free.
+    template <class F>
+        requires std::invocable<std::decay_t<F>&>
+    void Post(F&& f)
+    {
+        m_Queue.Push(Job::Create(std::forward<F>(f)));
+
+        // Posts and drains hand the strand over through this count: whoever brings it up from 0 starts the drain.
+        if (m_Pending.fetch_add(1, std::memory_order_acq_rel) == 0)
+            Schedule();
+    }
+
+    /// @brief Gets the number of items posted and not run yet.
+    inline std::size_t GetPendingCount() const { return m_Pending.load(std::memory_order_relaxed); }
+
+private:
+    void Schedule();
+
+    /// @brief Runs queued items in order, up to a slice. Only ever one drain of a strand runs at a time.
+    void Drain();
+
+private:
+    JobSystem&   m_JobSystem;
+    JobOptions   m_Options;
+    MpscJobQueue m_Queue;
+
+    /// @brief Items posted and not run yet. Non-zero exactly while a drain is scheduled or running.
+    alignas(kCacheLineSize) std::atomic<std::size_t> m_Pending = 0;
+};
+
+} // namespace Nodens
@@ -0,0 +1,24 @@
+#include "Task.h"
+
+#include "ndpch.h"
+
+namespace Nodens
+{
+
+void Detail::TaskPromiseBase::ReportDetachedException(std::exception_ptr exception)
+{
+    try
+    {
+        std::rethrow_exception(exception);
+    }
+    catch (const std::exception& e)
+    {
+        ND_CORE_ERROR("Unhandled exception in detached Task: {0}", e.what());
+    }
+    catch (...)
+    {
+        ND_CORE_ERROR("Unhandled unknown exception in detached Task.");
+    }
+}
+
+} // namespace Nodens
@@ -0,0 +1,242 @@
+#pragma once
+
+#include "Nodens/Memory/BlockPool.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Nodens
+{
+
+template <class T> class Task;
+
+namespace Detail
+{
+
+/// @brief State shared by every Task promise: the awaiting coroutine, a captured exception and the
+/// pooled frame allocation.
+class TaskPromiseBase
+{
+public:
+    /// @brief Coroutine frames up to this size come from block pools, larger ones from the heap.
+    static constexpr std::size_t kMaxPooledFrameSize = 1024;
+
+    /// @brief Tasks are lazy: nothing runs until the task is awaited or detached.
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    /// @brief Hands the thread over to the awaiting coroutine (symmetric transfer), or frees a detached task.
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+
+        template <class Promise> std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            TaskPromiseBase& promise = handle.promise();
+            if (promise.m_Continuation)
+                return promise.m_Continuation;
+
+            if (promise.m_Detached)
+            {
+                if (promise.m_Exception)
+                    ReportDetachedException(promise.m_Exception);
+                handle.destroy();
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() noexcept { m_Exception = std::current_exception(); }
+
+    /// @brief Allocates the coroutine frame from the smallest block pool it fits.
+    static void* operator new(std::size_t size)
+    {
+        if (size <= 256)
+            return BlockPool<256>::Allocate();
+        if (size <= 512)
+            return BlockPool<512>::Allocate();
+        if (size <= kMaxPooledFrameSize)
+            return BlockPool<kMaxPooledFrameSize>::Allocate();
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* frame, std::size_t size)
+    {
+        if (size <= 256)
+            BlockPool<256>::Free(frame);
+        else if (size <= 512)
+            BlockPool<512>::Free(frame);
+        else if (size <= kMaxPooledFrameSize)
+            BlockPool<kMaxPooledFrameSize>::Free(frame);
+        else
+            ::operator delete(frame, size);
+    }
+
+protected:
+    template <class T> friend class Nodens::Task;
+
+    void RethrowIfFailed() const
+    {
+        if (m_Exception)
+            std::rethrow_exception(m_Exception);
+    }
+
+    /// @brief Logs an exception that escaped a detached task, since nobody is left to rethrow it.
+    static void ReportDetachedException(std::exception_ptr exception);
+
+    std::coroutine_handle<> m_Continuation;
+    std::exception_ptr      m_Exception;
+    bool                    m_Detached = false;
+};
+
+template <class T> class TaskPromise : public TaskPromiseBase
+{
+public:
+    Task<T> get_return_object() noexcept;
+
+    template <class U>
+        requires std::convertible_to<U, T>
+    void return_value(U&& value)
+    {
+        m_Value.emplace(std::forward<U>(value));
+    }
+
+    T TakeResult()
+    {
+        RethrowIfFailed();
+        return std::move(*m_Value);
+    }
+
+private:
+    std::optional<T> m_Value;
+};
+
+template <> class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void TakeResult() { RethrowIfFailed(); }
+};
+
+} // namespace Detail
+
+/// @brief A lazily started coroutine producing a T.
+/// @details A Task does nothing until it is awaited or detached. Awaiting a task from another coroutine starts it
+/// on the awaiting thread and suspends the awaiter without blocking anything; when the task finishes, the awaiter
+/// continues on whichever thread finished it. Use JobSystem::Schedule() to move a coroutine onto a worker and
+/// NextFrame() (see Application.h) to come back to the main thread. Frames are allocated from block pools.
+///
+/// @code
+/// Task<Mesh> LoadMesh(JobSystem& jobs, std::string path)
+/// {
+///     co_await jobs.Schedule();   // now on a worker
+///     Mesh mesh = ParseMesh(path);
+///     co_return mesh;
+/// }
+///
+/// Task<void> Spawn(JobSystem& jobs)
+/// {
+///     Mesh mesh = co_await LoadMesh(jobs, "planet.obj"); // suspends, no thread blocked
+///     co_await NextFrame();                              // back on the main thread
+///     Upload(mesh);
+/// }
+///
+/// Spawn(jobs).Detach();
+/// @endcode
+/// @tparam T The result type. Use void for tasks that produce nothing.
+template <class T = void> class [[nodiscard]] Task
+{
+public:
+    using promise_type = Detail::TaskPromise<T>;
+
+    Task() = default;
+
+    Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_Handle)
+                m_Handle.destroy();
+            m_Handle = std::exchange(other.m_Handle, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    /// @brief Destroys the coroutine. A task must not be destroyed while it is running.
+    ~Task()
+    {
+        if (m_Handle)
+            m_Handle.destroy();
+    }
+
+    /// @brief Checks whether the task holds a coroutine.
+    inline bool IsValid() const { return static_cast<bool>(m_Handle); }
+
+    /// @brief Checks whether the coroutine has run to completion.
+    inline bool IsDone() const { return m_Handle && m_Handle.done(); }
+
+    /// @brief Starts the task on the calling thread and gives up ownership (fire-and-forget).
+    /// @details The coroutine frame frees itself when it finishes. Exceptions escaping it are logged.
+    void Detach()
+    {
+        std::coroutine_handle<promise_type> handle = std::exchange(m_Handle, nullptr);
+        handle.promise().m_Detached = true;
+        handle.resume();
+    }
+
+    /// @brief Starts the task and suspends the awaiting coroutine until it finishes.
+    /// @return The task's result. Exceptions thrown by the task are rethrown here.
+    auto operator co_await() && noexcept { return Awaiter{m_Handle}; }
+    auto operator co_await() & noexcept { return Awaiter{m_Handle}; }
+
+private:
+    friend promise_type;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+
+    struct Awaiter
+    {
+        std::coroutine_handle<promise_type> Handle;
+
+        bool await_ready() const noexcept { return !Handle || Handle.done(); }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+        {
+            Handle.promise().m_Continuation = awaiter;
+            return Handle;
+        }
+
+        T await_resume() { return Handle.promise().TakeResult(); }
+    };
+
+private:
+    std::coroutine_handle<promise_type> m_Handle;
+};
+
+template <class T> Task<T> Detail::TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> Detail::TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+} // namespace Nodens
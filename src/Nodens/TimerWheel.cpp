@@ -0,0 +1,341 @@
+#include "TimerWheel.h"
+
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace Nodens
+{
+
+TimerWheel::TimerWheel(JobSystem& jobSystem) : m_JobSystem(jobSystem), m_Start(Clock::now())
+{
+    m_Heads.fill(kNone);
+}
+
+TimerWheel::~TimerWheel()
+{
+    // Join before touching the entries, the thread may be submitting due jobs right now.
+    if (m_Thread.joinable())
+    {
+        m_Thread.request_stop();
+        m_Condition.notify_all();
+        m_Thread.join();
+    }
+
+    // Release the timers that never fired, so the callables (and their captures) are destroyed.
+    for (Entry& entry : m_Entries)
+    {
+        if (entry.PendingJob)
+            entry.PendingJob->Discard();
+    }
+}
+
+TimerHandle TimerWheel::Schedule(Job* job, const JobOptions& options, Clock::duration delay)
+{
+    const uint64_t expiry = ToTick(Clock::now() + delay);
+
+    std::scoped_lock lock(m_Mutex);
+    uint32_t         index = AllocateLocked();
+    Entry&           entry = m_Entries[index];
+    entry.Expiry           = expiry;
+    entry.PendingJob       = job;
+    entry.Options          = options;
+    return InsertLocked(index);
+}
+
+TimerHandle TimerWheel::ScheduleEvery(std::function<void()> callback, const JobOptions& options,
+                                      Clock::duration period)
+{
+    const auto     periodTicks = std::chrono::ceil<std::chrono::milliseconds>(period) / kTickDuration;
+    const uint64_t ticks       = static_cast<uint64_t>(std::max<int64_t>(periodTicks, 1));
+    const uint64_t expiry      = ToTick(Clock::now() + period);
+
+    std::scoped_lock lock(m_Mutex);
+    uint32_t         index = AllocateLocked();
+    Entry&           entry = m_Entries[index];
+    entry.Expiry           = expiry;
+    entry.Period           = ticks;
+    entry.Callback         = std::make_shared<std::function<void()>>(std::move(callback));
+    entry.Options          = options;
+    return InsertLocked(index);
+}
+
+bool TimerWheel::Cancel(TimerHandle handle)
+{
+    Job* job = nullptr;
+    {
+        std::scoped_lock lock(m_Mutex);
+        if (handle.Index >= m_Entries.size())
+            return false;
+
+        Entry& entry = m_Entries[handle.Index];
+        if (entry.Generation != handle.Generation || entry.Slot == kNone)
+            return false;
+
+        job = std::exchange(entry.PendingJob, nullptr);
+        UnlinkLocked(handle.Index);
+        FreeLocked(handle.Index);
+    }
+
+    // Destroy the callable outside the lock, its destructor may do anything.
+    if (job)
+        job->Discard();
+    return true;
+}
+
+std::size_t TimerWheel::GetActiveCount()
+{
+    std::scoped_lock lock(m_Mutex);
+    return m_ActiveCount;
+}
+
+void TimerWheel::ThreadLoop(std::stop_token stoken)
+{
+    std::vector<std::pair<Job*, JobOptions>> due;
+
+    std::unique_lock lock(m_Mutex);
+    while (!stoken.stop_requested())
+    {
+        AdvanceLocked(GetElapsedTicks());
+
+        if (!m_Due.empty())
+        {
+            // Submit outside the lock, so scheduling and cancelling never wait on the job queues.
+            due.swap(m_Due);
+            lock.unlock();
+            {
+                ZoneScopedN("Fire Timers");
+                for (auto& [job, options] : due)
+                    m_JobSystem.Enqueue(job, options);
+            }
+            due.clear();
+            lock.lock();
+            continue;
+        }
+
+        m_WakeTick   = NextEventTickLocked();
+        m_Reschedule = false;
+        if (m_WakeTick == kNever)
+        {
+            m_Condition.wait(lock, stoken, [this] { return m_Reschedule; });
+        }
+        else
+        {
+            const Clock::time_point wakeTime = m_Start + m_WakeTick * kTickDuration;
+            m_Condition.wait_until(lock, stoken, wakeTime, [this] { return m_Reschedule; });
+        }
+    }
+}
+
+uint64_t TimerWheel::ToTick(Clock::time_point time) const
+{
+    auto elapsed = std::chrono::ceil<std::chrono::milliseconds>(time - m_Start) / kTickDuration;
+    return static_cast<uint64_t>(std::max<int64_t>(elapsed, 0));
+}
+
+uint64_t TimerWheel::GetElapsedTicks() const
+{
+    return static_cast<uint64_t>((Clock::now() - m_Start) / kTickDuration);
+}
+
+uint32_t TimerWheel::AllocateLocked()
+{
+    if (m_FreeList == kNone)
+    {
+        m_Entries.emplace_back();
+        return static_cast<uint32_t>(m_Entries.size() - 1);
+    }
+
+    uint32_t index = m_FreeList;
+    m_FreeList     = m_Entries[index].Next;
+    return index;
+}
+
+void TimerWheel::FreeLocked(uint32_t index)
+{
+    Entry& entry = m_Entries[index];
+
+    // Generation 0 never occurs, so a default-constructed handle is always stale.
+    uint32_t generation = entry.Generation + 1;
+    entry               = Entry();
+    entry.Generation    = generation == 0 ? 1 : generation;
+    entry.Next          = m_FreeList;
+    m_FreeList          = index;
+
+    m_ActiveCount--;
+    TracyPlot("Active Timers", static_cast<int64_t>(m_ActiveCount));
+}
+
+void TimerWheel::LinkLocked(uint32_t index)
+{
+    Entry& entry = m_Entries[index];
+
+    // The level is picked by how far away the expiry is, the slot by the expiry's bits at that level. Timers
+    // beyond the top level wait in its last slot and are re-sorted when it comes up.
+    const uint64_t delta  = entry.Expiry - m_CurrentTick;
+    const uint64_t expiry = m_CurrentTick + std::min(delta, kMaxDelta);
+
+    int level = 0;
+    while (level < kLevels - 1 && delta >> ((level + 1) * kLevelBits) != 0)
+        level++;
+
+    const uint32_t slotInLevel = static_cast<uint32_t>((expiry >> (level * kLevelBits)) & kSlotMask);
+    const uint32_t slot        = level * kSlots + slotInLevel;
+
+    entry.Slot = slot;
+    entry.Prev = kNone;
+    entry.Next = m_Heads[slot];
+    if (entry.Next != kNone)
+        m_Entries[entry.Next].Prev = index;
+    m_Heads[slot] = index;
+    m_Occupied[level] |= uint64_t(1) << slotInLevel;
+}
+
+void TimerWheel::UnlinkLocked(uint32_t index)
+{
+    Entry&         entry = m_Entries[index];
+    const uint32_t slot  = entry.Slot;
+
+    if (entry.Prev != kNone)
+        m_Entries[entry.Prev].Next = entry.Next;
+    else
+        m_Heads[slot] = entry.Next;
+    if (entry.Next != kNone)
+        m_Entries[entry.Next].Prev = entry.Prev;
+
+    if (m_Heads[slot] == kNone)
+        m_Occupied[slot / kSlots] &= ~(uint64_t(1) << (slot % kSlots));
+
+    entry.Slot = kNone;
+    entry.Prev = kNone;
+    entry.Next = kNone;
+}
+
+TimerHandle TimerWheel::InsertLocked(uint32_t index)
+{
+    Entry& entry = m_Entries[index];
+
+    // Anything due by now fires on the next tick the thread processes.
+    entry.Expiry = std::max(entry.Expiry, m_CurrentTick + 1);
+    LinkLocked(index);
+
+    m_ActiveCount++;
+    TracyPlot("Active Timers", static_cast<int64_t>(m_ActiveCount));
+
+    if (!m_Thread.joinable())
+    {
+        m_Thread = std::jthread(
+            [this](std::stop_token stoken)
+            {
+                // Profiler hook: Give the thread a name so we can see it when
+                // using Tracy.
+                tracy::SetThreadName("Timer Thread");
+
+                this->ThreadLoop(stoken);
+            });
+    }
+    else if (entry.Expiry < m_WakeTick)
+    {
+        m_Reschedule = true;
+        m_Condition.notify_one();
+    }
+
+    return TimerHandle{index, entry.Generation};
+}
+
+uint64_t TimerWheel::NextEventTickLocked() const
+{
+    uint64_t next = kNever;
+    for (int level = 0; level < kLevels; ++level)
+    {
+        if (m_Occupied[level] == 0)
+            continue;
+
+        // Rotate the occupancy so bit 0 is the slot after the current one. Level 0 slots fire at their tick,
+        // higher slots cascade when their period starts.
+        const int      shift    = level * kLevelBits;
+        const uint64_t period   = m_CurrentTick >> shift;
+        const int      current  = static_cast<int>(period & kSlotMask);
+        const uint64_t rotated  = std::rotr(m_Occupied[level], current + 1);
+        const uint64_t distance = static_cast<uint64_t>(std::countr_zero(rotated)) + 1;
+        next                    = std::min(next, (period + distance) << shift);
+    }
+    return next;
+}
+
+void TimerWheel::AdvanceLocked(uint64_t now)
+{
+    while (m_CurrentTick < now)
+    {
+        // Nothing happens in between, so jump straight to the next tick with work.
+        const uint64_t next = NextEventTickLocked();
+        if (next > now)
+        {
+            m_CurrentTick = now;
+            return;
+        }
+        m_CurrentTick = next;
+
+        // Higher levels cascade first, so timers they move into the current level-0 slot fire right away.
+        for (int level = kLevels - 1; level > 0; --level)
+        {
+            const int shift = level * kLevelBits;
+            if ((m_CurrentTick & ((uint64_t(1) << shift) - 1)) == 0)
+                CascadeLocked(level, static_cast<uint32_t>((m_CurrentTick >> shift) & kSlotMask));
+        }
+        ExpireLocked();
+    }
+}
+
+void TimerWheel::CascadeLocked(int level, uint32_t slot)
+{
+    uint32_t index = m_Heads[level * kSlots + slot];
+    while (index != kNone)
+    {
+        uint32_t next = m_Entries[index].Next;
+        UnlinkLocked(index);
+        LinkLocked(index);
+        index = next;
+    }
+}
+
+void TimerWheel::ExpireLocked()
+{
+    uint32_t index = m_Heads[m_CurrentTick & kSlotMask];
+    while (index != kNone)
+    {
+        Entry&   entry = m_Entries[index];
+        uint32_t next  = entry.Next;
+        UnlinkLocked(index);
+
+        if (entry.Period == 0)
+        {
+            m_Due.emplace_back(std::exchange(entry.PendingJob, nullptr), entry.Options);
+            FreeLocked(index);
+        }
+        else if (entry.Options.Cancellation.stop_requested())
+        {
+            // The group was cancelled: the timer ends instead of submitting jobs that would be dropped.
+            FreeLocked(index);
+        }
+        else
+        {
+            Job* job = Job::Create(
+                [callback = entry.Callback]()
+                {
+                    if (!JobSystem::IsCancellationRequested())
+                        (*callback)();
+                });
+            m_Due.emplace_back(job, entry.Options);
+
+            // Keep the schedule, but skip firings that are already in the past.
+            entry.Expiry = std::max(entry.Expiry + entry.Period, m_CurrentTick + 1);
+            LinkLocked(index);
+        }
+        index = next;
+    }
+}
+
+} // namespace Nodens
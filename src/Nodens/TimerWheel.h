@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Nodens/JobSystem.h"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include <tracy/Tracy.hpp>
+
+namespace Nodens
+{
+
+/// @brief A hierarchical timer wheel that submits jobs to a JobSystem once their time has come.
+/// @details Four wheels of 64 slots each cover 1 ms ticks up to about 4.6 hours; later timers wait in the top wheel
+/// and are re-sorted when it turns. Timers are intrusive list nodes in a pooled array, so inserting and cancelling
+/// are O(1), and a handle carries a generation so a stale one cannot cancel a reused entry. A single timer thread,
+/// started with the first timer, sleeps until the next occupied slot, moves due timers into the worker queues and
+/// never runs user code itself. Owned by the JobSystem; use JobSystem::SubmitAfter() and SubmitEvery().
+class TimerWheel
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief The resolution of the wheel. Timers never fire early and usually less than one tick late.
+    static constexpr std::chrono::milliseconds kTickDuration{1};
+
+    /// @brief Creates an empty wheel. No thread is started until the first timer is scheduled.
+    /// @param jobSystem The system due jobs are submitted to. Must outlive the wheel.
+    explicit TimerWheel(JobSystem& jobSystem);
+
+    /// @brief Stops the timer thread. One-shot jobs that have not fired are discarded without running.
+    ~TimerWheel();
+
+    TimerWheel(const TimerWheel&)            = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /// @brief Submits 'job' with 'options' once 'delay' has passed. Takes ownership of the job.
+    TimerHandle Schedule(Job* job, const JobOptions& options, Clock::duration delay);
+
+    /// @brief Submits a job calling 'callback' every 'period', the first time one period from now.
+    /// @details Firings are spaced from the scheduled times, not from when the jobs finished, and missed firings are
+    /// skipped rather than caught up. The timer stops once options.Cancellation is stopped.
+    TimerHandle ScheduleEvery(std::function<void()> callback, const JobOptions& options, Clock::duration period);
+
+    /// @brief Cancels a timer that has not fired yet (or a periodic one). Jobs already submitted still run.
+    /// @return False if the handle is stale: the timer already fired, was cancelled or never existed.
+    bool Cancel(TimerHandle handle);
+
+    /// @brief Gets the number of timers waiting to fire.
+    std::size_t GetActiveCount();
+
+private:
+    static constexpr int      kLevelBits = 6;
+    static constexpr int      kLevels    = 4;
+    static constexpr uint32_t kSlots     = 1u << kLevelBits;
+    static constexpr uint64_t kSlotMask  = kSlots - 1;
+    static constexpr uint64_t kMaxDelta  = (uint64_t(1) << (kLevels * kLevelBits)) - 1;
+    static constexpr uint32_t kNone      = ~0u;
+    static constexpr uint64_t kNever     = ~uint64_t(0);
+
+    struct Entry
+    {
+        /// @brief The tick the timer fires at.
+        uint64_t Expiry = 0;
+
+        /// @brief Ticks between firings, 0 for one-shot timers.
+        uint64_t Period = 0;
+
+        /// @brief The job of a one-shot timer, created at scheduling time.
+        Job* PendingJob = nullptr;
+
+        /// @brief The callback of a periodic timer, shared with the jobs it submitted.
+        std::shared_ptr<std::function<void()>> Callback;
+
+        JobOptions Options;
+
+        /// @brief Bumped whenever the entry is freed, which invalidates outstanding handles.
+        uint32_t Generation = 1;
+
+        /// @brief Links within a slot list, or the free list (Next only).
+        uint32_t Prev = kNone;
+        uint32_t Next = kNone;
+
+        /// @brief The slot (level * kSlots + index) the entry is linked into, kNone while free.
+        uint32_t Slot = kNone;
+    };
+
+    /// @brief The loop executed by the timer thread until it is stopped.
+    void ThreadLoop(std::stop_token stoken);
+
+    /// @brief Converts a point in time to a tick, rounding up so timers never fire early.
+    uint64_t ToTick(Clock::time_point time) const;
+
+    /// @brief Gets the number of ticks that have fully passed since the wheel was created.
+    uint64_t GetElapsedTicks() const;
+
+    /// @brief Gets an entry from the free list, growing the pool if needed. Requires m_Mutex.
+    uint32_t AllocateLocked();
+
+    /// @brief Returns an entry to the free list and invalidates its handles. Requires m_Mutex.
+    void FreeLocked(uint32_t index);
+
+    /// @brief Links an entry into the slot matching its expiry, relative to the current tick. Requires m_Mutex.
+    void LinkLocked(uint32_t index);
+
+    /// @brief Removes an entry from its slot. Requires m_Mutex.
+    void UnlinkLocked(uint32_t index);
+
+    /// @brief Registers a new entry and wakes the timer thread if it now has to wake up earlier. Requires m_Mutex.
+    TimerHandle InsertLocked(uint32_t index);
+
+    /// @brief Gets the next tick at which a slot fires or cascades, or kNever if no timer is pending.
+    uint64_t NextEventTickLocked() const;
+
+    /// @brief Advances the wheel up to 'now', collecting due jobs in m_Due. Requires m_Mutex.
+    void AdvanceLocked(uint64_t now);
+
+    /// @brief Re-sorts the timers of a higher-level slot into the lower levels. Requires m_Mutex.
+    void CascadeLocked(int level, uint32_t slot);
+
+    /// @brief Collects the timers of the current level-0 slot, rescheduling periodic ones. Requires m_Mutex.
+    void ExpireLocked();
+
+private:
+    JobSystem&              m_JobSystem;
+    const Clock::time_point m_Start;
+
+    /// @brief The last tick the wheel has been advanced to.
+    uint64_t m_CurrentTick = 0;
+
+    /// @brief The tick the timer thread sleeps until. Earlier timers wake it up.
+    uint64_t m_WakeTick   = kNever;
+    bool     m_Reschedule = false;
+
+    std::vector<Entry> m_Entries;
+    uint32_t           m_FreeList    = kNone;
+    std::size_t        m_ActiveCount = 0;
+
+    /// @brief First entry of every slot list, and one bit per non-empty slot for each level.
+    std::array<uint32_t, kLevels * kSlots> m_Heads;
+    std::array<uint64_t, kLevels>          m_Occupied = {};
+
+    /// @brief Jobs that came due, submitted by the timer thread once the lock is released.
+    std::vector<std::pair<Job*, JobOptions>> m_Due;
+
+    /// @brief Mutex to protect the wheel, the entries and the wake-up state.
+    TracyLockable(std::mutex, m_Mutex);
+
+    /// @note std::condition_variable_any is required to work with std::stop_token.
+    std::condition_variable_any m_Condition;
+
+    /// @warning Declared last so the thread is stopped before anything it uses is destroyed.
+    std::jthread m_Thread;
+};
+
+} // namespace Nodens
@@ -0,0 +1,202 @@
+#include "JobSystemPanel.h"
+
+#include "Nodens/Memory/ScratchArena.h"
+#include "ndpch.h"
+#include <tracy/Tracy.hpp>
+
+#include <imgui.h>
+#include <implot.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+namespace Nodens
+{
+
+// Bucket labels of the histograms: the exclusive upper bound of every bucket.
+static const std::array<const char*, JobHistogram::kBucketCount> kBucketLabels = {
+    "<1us",  "<2us",  "<4us",  "<8us",   "<16us",  "<32us",  "<64us",  "<128us", "<256us", "<512us",
+    "<1ms",  "<2ms",  "<4ms",  "<8ms",   "<16ms",  "<33ms",  "<66ms",  "<131ms", "<262ms", ">262ms"};
+
+void JobSystemPanel::OnImGuiRender(const JobSystem& jobSystem, bool* open)
+{
+    ZoneScoped;
+
+    Refresh(jobSystem);
+
+    if (!ImGui::Begin("Job System Telemetry", open))
+    {
+        ImGui::End();
+        return;
+    }
+
+    if (!m_HasSnapshot || m_IntervalSeconds <= 0.0)
+    {
+        ImGui::TextDisabled("Collecting...");
+        ImGui::End();
+        return;
+    }
+
+    const WorkerStats total = m_Interval.GetWorkerTotal();
+    ImGui::Text("%zu workers | %.0f jobs/s | %.0f%% busy | %.0f steals/s | %.0f wake-ups/s", m_Interval.Workers.size(),
+                total.JobsExecuted / m_IntervalSeconds, total.GetUtilization() * 100.0,
+                total.Steals / m_IntervalSeconds, total.WakeUps / m_IntervalSeconds);
+    ImGui::Text("Helping threads: %.0f jobs/s | Blocking pool: %.0f jobs/s",
+                m_Interval.Helpers.JobsExecuted / m_IntervalSeconds,
+                m_Interval.Blocking.JobsExecuted / m_IntervalSeconds);
+
+    if (ImGui::CollapsingHeader("Workers", ImGuiTreeNodeFlags_DefaultOpen))
+        DrawWorkerTable();
+    if (ImGui::CollapsingHeader("Utilization", ImGuiTreeNodeFlags_DefaultOpen))
+        DrawUtilizationPlots();
+    if (ImGui::CollapsingHeader("Wait and Execution Times", ImGuiTreeNodeFlags_DefaultOpen))
+        DrawHistograms();
+
+    ImGui::End();
+}
+
+void JobSystemPanel::Refresh(const JobSystem& jobSystem)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (m_HasSnapshot && now - m_Previous.Timestamp < kRefreshInterval)
+        return;
+
+    JobSystemStats current = jobSystem.GetStats();
+    if (m_HasSnapshot)
+    {
+        m_Interval        = current.Since(m_Previous);
+        m_IntervalSeconds = std::chrono::duration<double>(current.Timestamp - m_Previous.Timestamp).count();
+        m_Elapsed += static_cast<float>(m_IntervalSeconds);
+
+        if (m_HistoryTime.size() == kHistoryLength)
+        {
+            m_HistoryTime.erase(m_HistoryTime.begin());
+            m_UtilizationHistory.erase(m_UtilizationHistory.begin());
+            m_JobsPerSecondHistory.erase(m_JobsPerSecondHistory.begin());
+        }
+        const WorkerStats total = m_Interval.GetWorkerTotal();
+        m_HistoryTime.push_back(m_Elapsed);
+        m_UtilizationHistory.push_back(static_cast<float>(total.GetUtilization() * 100.0));
+        m_JobsPerSecondHistory.push_back(static_cast<float>(total.JobsExecuted / m_IntervalSeconds));
+    }
+
+    m_Previous    = std::move(current);
+    m_HasSnapshot = true;
+}
+
+void JobSystemPanel::DrawWorkerTable() const
+{
+    if (!ImGui::BeginTable("JobSystemWorkers", 9, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        return;
+
+    ImGui::TableSetupColumn("Thread");
+    ImGui::TableSetupColumn("Busy");
+    ImGui::TableSetupColumn("Jobs/s");
+    ImGui::TableSetupColumn("Steals/s");
+    ImGui::TableSetupColumn("Parks/s");
+    ImGui::TableSetupColumn("Wake-ups/s");
+    ImGui::TableSetupColumn("Wait p50/p99");
+    ImGui::TableSetupColumn("Exec p50/p99");
+    ImGui::TableSetupColumn("Exec total");
+    ImGui::TableHeadersRow();
+
+    auto row = [this](const char* name, const WorkerStats& stats, bool hasIdleTime)
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(name);
+        ImGui::TableNextColumn();
+        if (hasIdleTime)
+            ImGui::Text("%.0f%%", stats.GetUtilization() * 100.0);
+        else
+            ImGui::TextDisabled("-");
+        ImGui::TableNextColumn();
+        ImGui::Text("%.0f", stats.JobsExecuted / m_IntervalSeconds);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.0f", stats.Steals / m_IntervalSeconds);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", stats.Parks / m_IntervalSeconds);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", stats.WakeUps / m_IntervalSeconds);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.0f / %.0f us", stats.WaitTime.GetPercentileUs(0.5), stats.WaitTime.GetPercentileUs(0.99));
+        ImGui::TableNextColumn();
+        ImGui::Text("%.0f / %.0f us", stats.ExecutionTime.GetPercentileUs(0.5),
+                    stats.ExecutionTime.GetPercentileUs(0.99));
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f ms", std::chrono::duration<double, std::milli>(stats.BusyTime).count());
+    };
+
+    for (std::size_t i = 0; i < m_Interval.Workers.size(); ++i)
+    {
+        std::string name = "Worker " + std::to_string(i);
+        row(name.c_str(), m_Interval.Workers[i], true);
+    }
+    row("Helping", m_Interval.Helpers, false);
+    row("Blocking", m_Interval.Blocking, false);
+
+    ImGui::EndTable();
+}
+
+void JobSystemPanel::DrawUtilizationPlots() const
+{
+    std::pmr::vector<float> busy(&ScratchArena::Get());
+    busy.reserve(m_Interval.Workers.size());
+    for (const WorkerStats& worker : m_Interval.Workers)
+        busy.push_back(static_cast<float>(worker.GetUtilization() * 100.0));
+
+    if (ImPlot::BeginPlot("Busy per Worker", ImVec2(-1, 180)))
+    {
+        ImPlot::SetupAxes("Worker", "Busy %", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_None);
+        ImPlot::SetupAxisLimits(ImAxis_Y1, 0.0, 100.0, ImPlotCond_Always);
+        ImPlot::PlotBars("Busy", busy.data(), static_cast<int>(busy.size()));
+        ImPlot::EndPlot();
+    }
+
+    if (ImPlot::BeginPlot("History", ImVec2(-1, 180)))
+    {
+        ImPlot::SetupAxes("Seconds", "Busy %", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_None);
+        ImPlot::SetupAxisLimits(ImAxis_Y1, 0.0, 100.0, ImPlotCond_Always);
+        ImPlot::PlotLine("All workers", m_HistoryTime.data(), m_UtilizationHistory.data(),
+                         static_cast<int>(m_HistoryTime.size()));
+        ImPlot::EndPlot();
+    }
+
+    if (ImPlot::BeginPlot("Throughput", ImVec2(-1, 180)))
+    {
+        ImPlot::SetupAxes("Seconds", "Jobs/s", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotLine("All workers", m_HistoryTime.data(), m_JobsPerSecondHistory.data(),
+                         static_cast<int>(m_HistoryTime.size()));
+        ImPlot::EndPlot();
+    }
+}
+
+void JobSystemPanel::DrawHistograms() const
+{
+    // Everything that ran in the interval, wherever it ran.
+    WorkerStats all = m_Interval.GetWorkerTotal();
+    all += m_Interval.Helpers;
+    all += m_Interval.Blocking;
+
+    std::array<float, JobHistogram::kBucketCount> wait;
+    std::array<float, JobHistogram::kBucketCount> execution;
+    for (std::size_t i = 0; i < JobHistogram::kBucketCount; ++i)
+    {
+        wait[i]      = static_cast<float>(all.WaitTime.Buckets[i]);
+        execution[i] = static_cast<float>(all.ExecutionTime.Buckets[i]);
+    }
+
+    if (ImPlot::BeginPlot("Jobs per Duration", ImVec2(-1, 220)))
+    {
+        ImPlot::SetupAxes("Duration", "Jobs", ImPlotAxisFlags_None, ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxisTicks(ImAxis_X1, 0.0, static_cast<double>(JobHistogram::kBucketCount - 1),
+                               static_cast<int>(JobHistogram::kBucketCount), kBucketLabels.data());
+        ImPlot::SetupAxisLimits(ImAxis_X1, -0.5, JobHistogram::kBucketCount - 0.5, ImPlotCond_Always);
+        ImPlot::PlotBars("Wait", wait.data(), static_cast<int>(wait.size()), 0.4, -0.2);
+        ImPlot::PlotBars("Execution", execution.data(), static_cast<int>(execution.size()), 0.4, 0.2);
+        ImPlot::EndPlot();
+    }
+}
+
+} // namespace Nodens
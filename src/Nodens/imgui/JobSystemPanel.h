@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Nodens/JobSystem.h"
+
+#include <chrono>
+#include <vector>
+
+namespace Nodens
+{
+
+/// @brief A live ImGui/ImPlot view of JobSystem::GetStats().
+/// @details Shows, per worker, utilization, throughput, steals and parks, next to the wait and execution time
+/// distributions of the jobs that ran since the last refresh. The counters are sampled every kRefreshInterval,
+/// so the numbers stay readable; the utilization history covers the last kHistoryLength samples.
+class JobSystemPanel
+{
+public:
+    /// @brief Draws the panel in its own window.
+    /// @param jobSystem The system to show. Should stay the same between calls.
+    /// @param open Optional close button state, like ImGui::Begin().
+    void OnImGuiRender(const JobSystem& jobSystem, bool* open = nullptr);
+
+    /// @brief How often the counters are sampled.
+    static constexpr std::chrono::milliseconds kRefreshInterval{500};
+
+    /// @brief How many samples the utilization history keeps.
+    static constexpr std::size_t kHistoryLength = 120;
+
+private:
+    /// @brief Takes a new snapshot once the refresh interval has passed.
+    void Refresh(const JobSystem& jobSystem);
+
+    void DrawWorkerTable() const;
+    void DrawUtilizationPlots() const;
+    void DrawHistograms() const;
+
+private:
+    JobSystemStats m_Previous;
+    JobSystemStats m_Interval;
+    double         m_IntervalSeconds = 0.0;
+    bool           m_HasSnapshot     = false;
+
+    // Utilization history, one sample per refresh.
+    std::vector<float> m_HistoryTime;
+    std::vector<float> m_UtilizationHistory;
+    std::vector<float> m_JobsPerSecondHistory;
+    float              m_Elapsed = 0.0f;
+};
+
+} // namespace Nodens
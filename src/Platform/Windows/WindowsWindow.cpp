@@ -81,18 +81,17 @@ void WindowsWindow::Init(const WindowProps& props)
                                   data.Width       = width;
                                   data.Height      = height;
 
-                                  WindowResizeEvent event(width, height);
-                                  data.EventCallback(event);
+                                  // Dragging resizes many times per poll; only the final size is delivered.
+                                  data.Conflator.Post(WindowResizeEvent(width, height), data.EventCallback);
                                   // EventCallback is a void function that recieves an Event&.
-                                  // So this line is executing the callback function assigned by
+                                  // The conflator calls it for every event it delivers.
                               });
 
     glfwSetWindowCloseCallback(m_Window,
                                [](GLFWwindow* window)
                                {
-                                   WindowData&      data = *(WindowData*)glfwGetWindowUserPointer(window);
-                                   WindowCloseEvent event;
-                                   data.EventCallback(event);
+                                   WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+                                   data.Conflator.Post(WindowCloseEvent(), data.EventCallback);
                                });
 
     glfwSetKeyCallback(m_Window,
@@ -104,20 +103,17 @@ void WindowsWindow::Init(const WindowProps& props)
                            {
                            case GLFW_PRESS:
                            {
-                               KeyPressedEvent event(key, 0);
-                               data.EventCallback(event);
+                               data.Conflator.Post(KeyPressedEvent(key, 0), data.EventCallback);
                                break;
                            }
                            case GLFW_RELEASE:
                            {
-                               KeyReleasedEvent event(key);
-                               data.EventCallback(event);
+                               data.Conflator.Post(KeyReleasedEvent(key), data.EventCallback);
                                break;
                            }
                            case GLFW_REPEAT:
                            {
-                               KeyPressedEvent event(key, 1);
-                               data.EventCallback(event);
+                               data.Conflator.Post(KeyPressedEvent(key, 1), data.EventCallback);
                                break;
                            }
                            }
@@ -131,14 +127,12 @@ void WindowsWindow::Init(const WindowProps& props)
                                    {
                                    case GLFW_PRESS:
                                    {
-                                       MouseButtonPressedEvent event(button);
-                                       data.EventCallback(event);
+                                       data.Conflator.Post(MouseButtonPressedEvent(button), data.EventCallback);
                                        break;
                                    }
                                    case GLFW_RELEASE:
                                    {
-                                       MouseButtonReleasedEvent event(button);
-                                       data.EventCallback(event);
+                                       data.Conflator.Post(MouseButtonReleasedEvent(button), data.EventCallback);
                                        break;
                                    }
                                    }
@@ -147,17 +141,16 @@ void WindowsWindow::Init(const WindowProps& props)
     glfwSetScrollCallback(m_Window,
                           [](GLFWwindow* window, double xOffset, double yOffset)
                           {
-                              WindowData&        data = *(WindowData*)glfwGetWindowUserPointer(window);
-                              MouseScrolledEvent event((float)xOffset, (float)yOffset);
-                              data.EventCallback(event);
+                              WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+                              data.Conflator.Post(MouseScrolledEvent((float)xOffset, (float)yOffset),
+                                                  data.EventCallback);
                           });
 
     glfwSetCursorPosCallback(m_Window,
                              [](GLFWwindow* window, double xPos, double yPos)
                              {
-                                 WindowData&     data = *(WindowData*)glfwGetWindowUserPointer(window);
-                                 MouseMovedEvent event((float)xPos, (float)yPos);
-                                 data.EventCallback(event);
+                                 WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+                                 data.Conflator.Post(MouseMovedEvent((float)xPos, (float)yPos), data.EventCallback);
                              });
 }
 
@@ -171,6 +164,10 @@ void WindowsWindow::OnUpdate()
     ZoneScoped;
 
     glfwPollEvents();
+
+    // Deliver what the callbacks coalesced during the poll: one event per conflated type and frame
+    m_Data.Conflator.Flush(m_Data.EventCallback);
+
     m_Context->SwapBuffers();
 }
 
@@ -2,6 +2,7 @@
 
 #include <GLFW/glfw3.h>
 
+#include "Nodens/Events/EventConflator.h"
 #include "Nodens/GraphicsContext.h"
 #include "Nodens/Window.h"
 
@@ -42,6 +43,9 @@ private:
         bool         VSync;
 
         EventCallbackFn EventCallback;
+
+        // Coalesces the bursts of moves, scrolls and resizes of one poll, see OnUpdate()
+        EventConflator Conflator;
     };
 
     WindowData m_Data;